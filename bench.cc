@@ -0,0 +1,179 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <memory>
+#include <map>
+#include <cstring>
+#include <cstdio>
+#include "src/Timeseries.hh"
+#include "src/Solver.hh"
+#include "src/Sketch.hh"
+#include "test/Synthetic.hh"
+
+/* median and p95 (nearest rank) of the samples */
+struct Summary
+{
+    double median;
+    double p95;
+};
+
+static Summary summarize(std::vector<double> v)
+{
+    std::sort(v.begin(), v.end());
+    Summary ret;
+    ret.median = v[(v.size() - 1) / 2];
+    ret.p95 = v[std::min(v.size() - 1, (size_t)std::ceil(0.95 * v.size()) - 1)];
+    return ret;
+}
+
+static std::ostream &operator<<(std::ostream &o, const Summary &s)
+{
+    return o<<"{\"median\":"<<s.median<<",\"p95\":"<<s.p95<<"}";
+}
+
+static std::vector<size_t> parse_sizes(const std::string &s)
+{
+    std::vector<size_t> ret;
+    std::stringstream sin(s);
+    std::string part;
+    while(std::getline(sin, part, ','))
+        if(part.length()) ret.push_back(std::stoull(part));
+    return ret;
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "Usage: %s [--sizes 1000,10000,...] [--runs N] [--rate R]\n"
+            "\t[--loss L] [--jitter J] [--burst B] [--burst-len K] [--drift PPM]\n"
+            "\t[--values V] [--seed S] [--eps E]\n"
+            "\t[--solvers BruteForce,BruteForce+sketch,MinEpsilon] [--bucket SEC]\n"
+            "\t[--dir DIR] [--threads N]\n", name);
+}
+
+int main(int argc, char *argv[])
+{
+    test::SyntheticGen::Config cfg;
+    std::vector<size_t> sizes{1000, 10000, 100000, 1000000, 10000000};
+    std::string solvers{"BruteForce,BruteForce+sketch,MinEpsilon"};
+    std::string dir{"/tmp"};
+    unsigned runs = 5;
+    unsigned threads = 1;   // loader threads, 1 reads serially
+    double eps = 0.5;
+    double bucket = 0.05;   // time bucket of the sketches
+    for(int i = 1; i < argc; i++)
+    {
+        std::string key{argv[i]};
+        if(i + 1 >= argc) { usage(argv[0]); return -1; }
+        std::string val{argv[++i]};
+        if(key == "--sizes") sizes = parse_sizes(val);
+        else if(key == "--runs") runs = std::stoul(val);
+        else if(key == "--rate") cfg.rate = std::stod(val);
+        else if(key == "--loss") cfg.loss = std::stod(val);
+        else if(key == "--jitter") cfg.jitter = std::stod(val);
+        else if(key == "--burst") cfg.burst = std::stod(val);
+        else if(key == "--burst-len") cfg.burst_len = std::stoul(val);
+        else if(key == "--drift") cfg.drift = std::stod(val);
+        else if(key == "--values") cfg.values = std::stoull(val);
+        else if(key == "--seed") cfg.seed = std::stoul(val);
+        else if(key == "--eps") eps = std::stod(val);
+        else if(key == "--solvers") solvers = val;
+        else if(key == "--dir") dir = val;
+        else if(key == "--threads") threads = std::stoul(val);
+        else if(key == "--bucket") bucket = std::stod(val);
+        else { usage(argv[0]); return -1; }
+    }
+    if(runs == 0 || sizes.empty()) { usage(argv[0]); return -1; }
+
+    /* stdout only carries the results, the solver progress is dropped */
+    std::ofstream devnull("/dev/null");
+    std::cout.precision(9);
+
+    for(auto size : sizes)
+    {
+        cfg.len = size;
+        test::SyntheticGen gen(cfg);
+        std::string prefix = dir + "/bench-" + std::to_string(size) + "-";
+        std::cerr<<"bench: generating "<<size<<" points into "<<prefix<<"*.ts"<<std::endl;
+        gen.write(prefix);
+
+        /* median verification per solver, to report what the sketch saves */
+        std::map<std::string, double> verify_median;
+        std::stringstream names(solvers);
+        std::string name;
+        while(std::getline(names, name, ','))
+        {
+            /**
+             * a "+sketch" suffix builds the sketch of large. The index phase
+             * is that build plus the lookup structures the solver builds
+             */
+            std::string base = name;
+            bool use_sketch = false;
+            auto plus = name.find("+sketch");
+            if(plus != std::string::npos) { base = name.substr(0, plus); use_sketch = true; }
+            std::vector<double> load, index, generation, verification, solve;
+            src::SolveResult last;
+            size_t nsmall = 0, nlarge = 0;
+            for(unsigned r = 0; r < runs; r++)
+            {
+                std::unique_ptr<src::SolverBase> solver;
+                if(base == "BruteForce") solver.reset(new src::BruteForce(eps));
+                else if(base == "MinEpsilon") solver.reset(new src::MinEpsilon(eps));
+                else { std::cerr<<"bench: unknown solver "<<name<<std::endl; return -1; }
+                solver->setLog(devnull);
+
+                src::Stopwatch watch;
+                auto read = [threads](const std::string &f)
+                {
+                    if(threads == 1) return src::TimeseriesReader::ReadTwoCols(f);
+                    return src::TimeseriesReader::ReadTwoColsParallel(f, ' ', threads);
+                };
+                auto small{read(prefix + "small.ts")};
+                auto large{read(prefix + "large.ts")};
+                load.push_back(watch.elapsed().wall);
+                watch.restart();
+                std::unique_ptr<src::ValueTimeSketch> sketch;
+                if(use_sketch)
+                {
+                    sketch.reset(new src::ValueTimeSketch(large, bucket));
+                    solver->setSketch(sketch.get());
+                }
+                index.push_back(watch.elapsed().wall);
+                nsmall = small.size();
+                nlarge = large.size();
+
+                last = solver->solve(small, large);
+                index.back() += last.index.wall;
+                generation.push_back(last.generation.wall);
+                verification.push_back(last.verification.wall);
+                solve.push_back(last.generation.wall + last.verification.wall);
+            }
+            auto s = summarize(solve);
+            auto v = summarize(verification);
+            verify_median[name] = v.median;
+            std::ostringstream prefilter;
+            if(use_sketch)
+            {
+                prefilter.precision(9);
+                prefilter<<",\"prefilter\":{\"tested\":"<<last.prefilter.tested
+                    <<",\"passed\":"<<last.prefilter.passed<<",\"false_positive_rate\":"
+                    <<last.prefilter.false_positive_rate();
+                if(verify_median.count(base))
+                    prefilter<<",\"verification_saved\":"<<verify_median[base] - v.median;
+                prefilter<<"}";
+            }
+            std::cout<<"{\"size\":"<<size<<",\"small\":"<<nsmall<<",\"large\":"<<nlarge
+                <<",\"solver\":\""<<name<<"\",\"runs\":"<<runs
+                <<",\"found\":"<<(last.found() ? "true" : "false")
+                <<",\"offset_error\":"<<(last.found() ? std::fabs(last.offset + cfg.offset) : -1)
+                <<",\"candidates\":"<<last.generated<<",\"probes\":"<<last.probes
+                <<",\"load\":"<<summarize(load)<<",\"index\":"<<summarize(index)
+                <<",\"generation\":"<<summarize(generation)
+                <<",\"verification\":"<<v<<prefilter.str()<<",\"solve\":"<<s
+                <<",\"throughput\":"<<(nsmall + nlarge) / s.median<<"}"<<std::endl;
+        }
+        std::remove((prefix + "small.ts").c_str());
+        std::remove((prefix + "large.ts").c_str());
+    }
+    return 0;
+}
@@ -1,2048 +0,0 @@
-0.18222340 601
-0.30073466 601
-0.31984673 53
-0.57310699 601
-0.58155492 835
-0.72745845 1343
-0.87672829 989
-0.96981408 1343
-1.02995136 1343
-1.05726113 989
-1.14664740 573
-1.17034185 835
-1.27539570 1343
-1.31794433 0
-1.37045896 989
-1.38423451 1343
-1.47168213 601
-1.49164630 989
-1.52815153 573
-1.54691973 0
-1.67721094 1343
-1.70052971 573
-1.76118078 835
-1.89797479 0
-2.01292623 573
-2.02867456 573
-2.05909089 1343
-2.26074964 573
-2.34615580 601
-2.38659551 0
-2.45075930 0
-2.72718689 989
-2.80647747 601
-2.85456345 0
-2.91764142 1343
-3.05337685 573
-3.10246750 601
-3.11748051 835
-3.12736600 1343
-3.20147917 573
-3.24035104 989
-3.30807024 0
-3.37927138 989
-3.41880083 573
-3.45021502 53
-3.48999343 0
-3.58081385 989
-3.59564162 989
-3.61109653 835
-3.64545523 601
-3.66428382 989
-3.84033743 573
-4.02471572 989
-4.07726541 0
-4.14111229 835
-4.44782734 573
-4.65473642 989
-4.71941418 835
-4.73418219 53
-4.77195231 53
-5.00014086 573
-5.17262713 0
-5.17668710 0
-5.54136394 601
-5.57118762 989
-5.82988092 573
-5.83237154 835
-5.98040656 989
-5.99701319 835
-6.44681217 601
-6.55002042 835
-6.57054159 53
-6.60623030 601
-6.67616043 573
-6.70379710 601
-6.80420422 835
-6.90924969 1343
-7.06612805 989
-7.33365365 573
-7.64724823 573
-7.70377355 601
-7.78057626 989
-7.81683896 0
-7.88728967 835
-8.02021464 989
-8.17297561 0
-8.19172569 601
-8.27015196 1343
-8.28855301 835
-8.32082259 0
-8.32640874 601
-8.79772634 989
-9.28853287 0
-9.29319690 989
-9.53286504 989
-9.62642161 601
-10.42721070 601
-10.51776806 989
-10.74382314 989
-10.83408219 989
-10.89460111 835
-11.04544744 601
-11.06236387 0
-11.11954576 1343
-11.15787995 53
-11.22027360 989
-11.26252546 601
-11.26785399 53
-11.37538670 53
-11.59818573 0
-11.62314399 989
-11.68319324 835
-11.68740243 573
-11.97055513 989
-12.05521600 601
-12.06226209 989
-12.06332257 573
-12.07163756 989
-12.12256466 989
-12.21574626 989
-12.21849814 573
-12.30241398 835
-12.30745964 573
-12.33300883 1343
-12.55486313 53
-12.55901245 1343
-12.62131311 989
-12.63183590 835
-12.64575683 53
-12.69151515 835
-12.82118008 0
-12.84965435 1343
-12.97742770 0
-13.08170356 835
-13.09702154 573
-13.12023218 53
-13.20242795 1343
-13.26127216 835
-13.27897414 989
-13.42321289 573
-13.56540593 573
-13.58782259 0
-13.68793624 989
-13.72434673 53
-13.74971709 573
-13.88349547 835
-14.01026917 601
-14.10889701 573
-14.14404692 573
-14.28765537 53
-14.31293087 0
-14.42162321 601
-14.50664171 601
-14.78118421 0
-14.78242145 989
-14.85381848 601
-14.90483022 0
-15.07257146 0
-15.07893043 0
-15.10701336 601
-15.25115653 989
-15.29938351 989
-15.38638532 601
-15.41713309 601
-15.56226967 1343
-15.58910074 989
-15.62641744 0
-15.72012945 835
-15.72996095 1343
-15.84409868 0
-15.87467682 989
-15.90129795 835
-16.01714402 835
-16.07634074 573
-16.08052622 601
-16.14303253 989
-16.44511852 0
-16.52084914 53
-16.63589281 835
-16.78305649 989
-16.79891249 53
-16.92653665 835
-17.14646308 989
-17.15547056 53
-17.26280810 0
-17.31544422 835
-17.40360180 53
-17.41415065 1343
-17.75632536 601
-17.89181812 53
-17.99860043 601
-18.06950359 835
-18.21649354 1343
-18.21873894 601
-18.46153142 835
-18.62293809 835
-18.67949572 0
-18.74524562 989
-18.74811806 601
-18.82698943 601
-18.83989048 0
-19.10103757 835
-19.16009542 573
-19.20518453 601
-19.27463365 1343
-19.38689630 989
-19.62679859 573
-19.80714376 989
-19.85048001 989
-19.91902003 0
-20.05940783 573
-20.10091069 835
-20.18893668 53
-20.28462774 835
-20.60210890 989
-20.60771039 601
-20.70726171 989
-20.71163168 1343
-20.82389859 835
-20.82497219 53
-20.83693637 1343
-20.86862182 53
-20.91004800 835
-20.97541935 989
-21.22076061 601
-21.32096762 0
-21.35029895 601
-21.39450371 573
-21.42086388 1343
-21.48607957 0
-21.52195155 53
-21.55556554 601
-21.58037267 601
-21.73787125 573
-21.81385817 573
-21.81710345 573
-21.84395652 601
-21.95141435 601
-22.01726569 601
-22.02698937 573
-22.07780665 835
-22.25637166 601
-22.37879576 53
-22.45937535 601
-22.55687543 1343
-22.60462588 1343
-22.68790395 989
-22.70267341 601
-22.72322244 989
-22.77491106 0
-22.77663796 989
-22.78713953 1343
-22.84880432 0
-22.85374906 573
-23.05911022 601
-23.11817344 573
-23.12437915 53
-23.29623985 1343
-23.34028068 835
-23.76051343 1343
-23.80493775 0
-23.92267816 573
-23.96000377 601
-24.09456602 0
-24.15401121 53
-24.16629108 1343
-24.23893383 601
-24.24992964 53
-24.45398232 1343
-24.47684797 573
-24.49875786 573
-24.50061103 53
-24.55064608 0
-24.60189066 835
-24.73581187 53
-24.96150711 53
-24.97055160 573
-24.99155432 53
-25.07420720 989
-25.13565098 53
-25.14986257 0
-25.30200582 989
-25.30905519 601
-25.32095152 0
-25.37251838 573
-25.44310980 835
-25.45610236 53
-25.49051725 53
-25.52630571 53
-25.53737651 1343
-25.58652527 53
-25.62055549 573
-25.62894874 0
-25.64158524 835
-25.69899774 835
-25.72910820 573
-25.80704918 835
-25.83711398 601
-25.89604782 0
-26.06966331 989
-26.08631499 835
-26.10142678 1343
-26.20964953 1343
-26.47102847 0
-26.47693015 53
-26.71781688 835
-26.73034023 835
-26.94202312 1343
-27.14957739 53
-27.22462039 1343
-27.32941877 601
-27.35885550 601
-27.39313806 835
-27.49191309 1343
-27.53328131 0
-27.54194668 601
-27.57007860 601
-27.68749624 989
-27.71317392 53
-27.73320775 0
-27.76962828 573
-27.78459131 0
-27.79422641 835
-27.91534772 1343
-27.94395330 0
-28.01818166 573
-28.11559127 601
-28.42455959 601
-28.53969517 601
-28.56792565 835
-28.59674834 573
-28.62477133 989
-28.86462586 573
-28.96427428 1343
-29.05246979 1343
-29.05354545 53
-29.08483439 0
-29.30474020 53
-29.35705046 835
-29.36057553 573
-29.54765230 573
-29.60726636 0
-29.71598014 835
-29.83392648 989
-29.83968838 0
-29.94409444 0
-30.09887410 601
-30.25951547 573
-30.30917099 573
-30.31459086 573
-30.52137873 1343
-30.75352084 573
-30.75555981 53
-30.82427229 1343
-30.85403484 989
-30.89358797 0
-31.03453229 989
-31.07202601 989
-31.21521158 601
-31.24644747 573
-31.34076939 601
-31.40759350 573
-31.50957380 53
-31.70127273 0
-31.72758432 835
-31.86520229 1343
-31.90395276 601
-32.34625736 835
-32.50995524 989
-32.59311801 1343
-32.64065743 835
-32.68423709 573
-32.73093214 573
-32.76454216 601
-32.89359773 53
-32.95089955 53
-33.07746052 1343
-33.23197171 53
-33.28541046 1343
-33.31084463 573
-33.36666533 835
-33.44655287 835
-33.75880747 1343
-33.78559542 601
-33.98821495 53
-34.03833880 601
-34.13773100 573
-34.19705107 1343
-34.49806876 835
-34.49870636 0
-34.53563841 989
-34.61014757 835
-34.65366881 0
-34.76377460 53
-34.78057257 1343
-34.82568267 1343
-34.84274681 601
-34.86934234 53
-34.98729311 53
-35.00959898 601
-35.08275969 835
-35.09243762 1343
-35.21638217 835
-35.30995266 601
-35.32165404 989
-35.46038287 0
-35.52891492 1343
-35.56235260 573
-35.89234794 1343
-36.05742900 835
-36.15994969 0
-36.33878466 601
-36.46676655 1343
-36.70975349 573
-36.72196977 53
-36.83905850 573
-36.86906289 835
-36.89574207 601
-36.99800797 601
-37.04150330 1343
-37.08647440 1343
-37.15106333 601
-37.15389996 1343
-37.20522908 0
-37.25679068 0
-37.26843660 601
-37.29594986 573
-37.38902325 53
-37.57233923 53
-37.93575394 601
-38.12437975 53
-38.29102886 0
-38.33324559 835
-38.38290009 573
-38.41454000 0
-38.45436887 573
-38.47929902 601
-38.50493215 573
-38.56745344 601
-38.71861291 1343
-39.01836667 835
-39.10004512 601
-39.17265718 601
-39.29536189 0
-39.39913513 1343
-39.41729646 989
-39.49648989 573
-39.57456483 835
-39.62071879 601
-39.78706838 1343
-39.79184550 573
-39.88100294 53
-39.89499827 989
-39.98800577 601
-40.15644418 573
-40.21610476 601
-40.28052699 989
-40.32592138 0
-40.51734200 601
-40.56163666 1343
-40.64112779 573
-40.90860473 1343
-41.06690623 989
-41.18843999 0
-41.23919158 0
-41.42827990 835
-41.44431182 0
-41.58981271 601
-41.68228346 1343
-41.82304177 1343
-41.86715461 1343
-41.93459709 989
-42.08028040 0
-42.10022134 835
-42.32522652 573
-42.39702156 1343
-42.45836724 573
-42.46240332 835
-42.50678493 989
-42.55096719 835
-42.55334055 601
-42.58748563 0
-42.58835357 573
-42.65557569 1343
-42.79253611 989
-42.91491320 989
-43.01658479 601
-43.12724648 0
-43.29049007 53
-43.61096164 573
-43.65916934 0
-43.69003679 573
-43.96130441 573
-43.97912619 835
-44.01025956 601
-44.06018868 835
-44.16687003 0
-44.24929104 989
-44.34388062 601
-44.36597664 601
-44.48423209 0
-44.49471366 835
-44.64418458 601
-44.66714571 0
-44.66865951 601
-44.91196595 573
-44.95454494 573
-44.99497530 601
-45.05134769 835
-45.08286375 835
-45.16423665 835
-45.17007006 53
-45.20921875 989
-45.23134848 573
-45.48819972 1343
-45.65409459 0
-45.83142483 0
-45.90318556 573
-45.97003527 53
-46.03118223 573
-46.05354484 0
-46.13365326 835
-46.17076213 0
-46.19893922 0
-46.32416262 53
-46.39028063 53
-46.39168322 835
-46.47292693 989
-46.62538178 835
-46.92442464 1343
-47.03267809 53
-47.47058705 1343
-47.47461215 573
-47.65669962 1343
-47.87604233 53
-47.92051585 601
-48.03564210 835
-48.07053316 1343
-48.34745540 53
-48.35628416 835
-48.42166428 573
-48.49512071 601
-48.75783060 0
-48.97301982 989
-49.09526608 53
-49.49938016 989
-49.57672057 1343
-49.62146972 573
-49.94253852 601
-50.00770603 989
-50.02850185 0
-50.19909026 601
-50.42383609 573
-50.47650616 53
-50.49179880 53
-50.64298504 0
-50.67397026 601
-50.68317384 601
-50.71451211 1343
-50.72689278 989
-50.73146266 601
-50.77622720 835
-50.80898137 601
-50.89085115 573
-50.98852221 989
-51.04050814 0
-51.06181122 0
-51.18203162 573
-51.25328419 1343
-51.38667082 835
-51.62236129 0
-51.74673327 835
-51.74716514 0
-51.85950328 601
-51.91095133 989
-52.08715335 835
-52.10672471 835
-52.13556861 0
-52.18039835 1343
-52.25978576 53
-52.63732957 989
-52.68541321 989
-52.73956521 53
-52.85583989 0
-52.86823751 1343
-53.21378367 989
-53.21916134 1343
-53.40215165 1343
-53.52445162 989
-53.55034210 601
-53.65349120 0
-53.66331798 1343
-53.75169832 835
-53.78660801 0
-53.84913550 573
-54.02961760 835
-54.03554312 0
-54.13610617 53
-54.15271606 835
-54.22296190 1343
-54.22784946 53
-54.65251694 0
-54.75825219 53
-54.87306227 835
-55.21999159 53
-55.24469035 601
-55.32185276 1343
-55.40617809 1343
-55.51802638 601
-55.53539106 53
-55.56083550 835
-55.61917721 1343
-55.65118709 601
-55.73942097 573
-55.75779442 573
-55.79221826 989
-55.88047543 573
-55.90048465 989
-55.91524623 53
-56.08719257 53
-56.16424693 573
-56.30445157 0
-56.38793421 573
-56.49182544 1343
-56.49583988 835
-56.57251474 0
-56.62456680 989
-56.80586437 601
-56.82269568 0
-56.82420964 0
-56.93926780 601
-56.95761850 835
-57.09360620 0
-57.19548244 601
-57.28370560 53
-57.31157718 1343
-57.43624018 835
-57.47713280 601
-57.52584064 0
-57.82143312 601
-57.86164668 573
-57.98071532 53
-58.01555550 1343
-58.06964637 0
-58.08124566 53
-58.16331295 835
-58.45082481 53
-58.47563763 989
-58.61764823 573
-58.72330407 53
-58.72853194 989
-58.75628356 989
-59.03896761 835
-59.07474989 835
-59.08508415 53
-59.20124476 53
-59.25883920 989
-59.26151683 573
-59.26311430 1343
-59.28932717 1343
-59.33065069 0
-59.60965131 835
-59.72104815 989
-59.79830523 601
-59.80654196 601
-59.99215367 1343
-60.15050511 53
-60.15105665 573
-60.18643762 989
-60.22960610 1343
-60.24480108 601
-60.34794141 989
-60.54220751 835
-60.54483961 573
-61.11137038 1343
-61.20711830 989
-61.21025798 53
-61.21305088 989
-61.30849086 835
-61.32889689 1343
-61.36757225 1343
-61.36810811 573
-61.52639702 573
-61.57343048 0
-61.60567055 0
-61.72814237 53
-61.76752391 835
-61.83559424 835
-62.03572545 989
-62.09241135 601
-62.21152748 573
-62.41008907 989
-62.93970454 989
-63.04178018 573
-63.18543954 835
-63.20740055 573
-63.26035194 0
-63.41584260 53
-63.64463801 1343
-63.64980000 53
-63.73133346 1343
-63.98481659 0
-64.00413915 601
-64.02297725 835
-64.09162746 573
-64.10280715 989
-64.13801614 989
-64.14113572 53
-64.21127458 601
-64.36082614 989
-64.36368215 835
-64.69305926 53
-64.71776530 0
-64.71853244 573
-64.86430270 573
-64.92618278 835
-64.96729627 835
-65.02532948 601
-65.11433783 53
-65.12179954 601
-65.15051565 835
-65.18728104 601
-65.25248123 0
-65.39758598 1343
-65.67745093 1343
-65.68538216 989
-65.70000630 835
-65.70801411 1343
-65.71016214 0
-65.90064918 835
-65.92988536 53
-66.00258031 53
-66.09044408 53
-66.38686656 0
-66.48988088 53
-66.51583462 835
-66.60750383 53
-66.63522299 1343
-66.65563425 0
-66.75046280 601
-66.78365570 573
-66.93349051 989
-66.95954211 1343
-66.98490589 1343
-67.03379279 601
-67.06625469 573
-67.17444428 835
-67.18238895 989
-67.23646370 989
-67.32628607 0
-67.38263655 601
-67.49278749 53
-67.56229272 573
-67.57901144 835
-67.74935489 0
-67.76364288 835
-67.82876058 573
-67.89072754 53
-68.04310595 1343
-68.05223448 835
-68.09183967 573
-68.16192776 989
-68.29318843 989
-68.31597149 53
-68.33349934 989
-68.66645624 573
-68.71195265 989
-68.84798389 0
-68.89949805 53
-68.97163374 601
-69.07627874 989
-69.30332721 573
-69.39050172 989
-69.42834199 835
-69.54877511 573
-69.67091788 0
-69.84836303 53
-69.85334268 835
-69.86077329 53
-69.98935626 835
-70.03465842 601
-70.03585009 0
-70.06425932 835
-70.27645539 835
-70.34509213 989
-70.52890184 989
-70.55205047 989
-70.59616451 1343
-70.60226265 573
-70.66319397 0
-70.72447521 601
-70.76159616 0
-70.94628344 989
-70.95343581 989
-70.98121419 989
-71.01727900 989
-71.06956209 1343
-71.07851378 573
-71.09462099 53
-71.10935482 989
-71.20770196 601
-71.37699444 573
-71.59016956 1343
-71.65381662 835
-71.65633093 573
-71.76954445 0
-71.86683962 835
-71.89221613 0
-72.04968620 573
-72.40188481 1343
-72.42296791 53
-72.44397063 573
-72.69549830 1343
-72.70445403 0
-72.84964809 53
-72.96928410 601
-73.35296737 1343
-73.39074622 53
-73.40513204 835
-73.40950642 601
-73.42835562 989
-73.46181051 989
-73.46391024 1343
-73.54602097 1343
-73.55973055 573
-73.66866485 1343
-73.70261628 53
-73.76867958 989
-73.77426116 989
-73.78182125 601
-74.04110383 53
-74.06837397 835
-74.19329716 573
-74.36204277 1343
-74.71118315 0
-74.71716451 0
-74.74943160 573
-74.96637901 53
-74.98614266 835
-75.12666632 0
-75.26854527 835
-75.40270728 0
-75.48407863 573
-75.54247184 835
-75.65297797 1343
-75.72518964 989
-75.73763008 835
-75.93457302 989
-75.96593006 0
-75.96643434 53
-76.00237166 989
-76.03426856 1343
-76.11232401 989
-76.17826191 53
-76.23455461 573
-76.28737695 573
-76.47751012 53
-76.56804578 0
-76.67747478 1343
-76.73370514 1343
-76.89275736 573
-76.95136473 989
-76.97006898 601
-76.99933081 573
-77.05393160 989
-77.13803173 835
-77.17866170 835
-77.26301516 0
-77.56878423 0
-77.58779239 601
-77.83880395 1343
-77.90804646 0
-77.91470650 53
-77.92456399 989
-77.93548890 0
-77.95024826 601
-77.96672876 835
-77.98380870 573
-78.35269917 573
-78.36270785 601
-78.40079224 0
-78.52324720 0
-78.62561877 601
-78.67927923 573
-78.73506624 0
-78.76998641 53
-78.77338094 1343
-78.83187349 53
-78.85333515 989
-78.93822488 53
-78.95959290 601
-78.99055183 601
-79.04030500 573
-79.06571182 1343
-79.08350524 53
-79.09519132 573
-79.20009233 835
-79.36185210 1343
-79.39962928 0
-79.40833902 601
-79.48423396 573
-79.74092487 53
-79.78724846 601
-80.10819419 573
-80.17119637 989
-80.24892295 573
-80.34591447 53
-80.46124933 53
-80.50314158 835
-80.53709436 0
-80.62272100 573
-80.70686004 1343
-81.09975105 989
-81.18749858 573
-81.28514724 0
-81.45585641 989
-81.50301294 53
-81.70845508 835
-81.72316097 573
-81.98496546 0
-82.16911681 835
-82.19734960 835
-82.21060191 835
-82.21106225 573
-82.21999518 989
-82.23910583 53
-82.35111389 835
-82.40150535 835
-82.40192961 1343
-82.40723235 989
-82.44814476 573
-82.51593075 989
-82.76092279 53
-82.79919370 0
-82.91072302 573
-82.94690147 601
-83.21916527 601
-83.25276745 835
-83.44262483 573
-83.45549813 835
-83.46754408 1343
-83.47650370 1343
-83.49305010 835
-83.50422921 53
-83.54051857 601
-83.57916051 601
-83.64151613 53
-83.68498355 835
-83.74351943 0
-83.76386418 53
-83.87618754 0
-84.09837850 0
-84.18990195 835
-84.75564116 0
-84.85183864 601
-84.90154823 573
-85.03241324 0
-85.23021943 53
-85.26909273 835
-85.42738830 835
-85.45045568 573
-85.51810977 1343
-85.54870697 989
-85.55340419 1343
-85.81665430 835
-85.86947517 53
-85.93717596 53
-85.98251889 573
-85.99716058 835
-86.05195224 601
-86.17925429 573
-86.25832996 1343
-86.30905668 53
-86.36087516 1343
-86.74449906 835
-86.84171027 1343
-86.93507698 1343
-86.97552094 0
-87.03718992 835
-87.08311376 601
-87.16337179 989
-87.29066589 989
-87.49049491 573
-87.51751417 1343
-87.97983748 835
-88.24127844 573
-88.29770453 0
-88.37502056 601
-88.39170056 53
-88.42880677 989
-88.49563146 989
-88.54793062 835
-88.89381383 835
-88.94343639 53
-89.01720004 0
-89.05355631 0
-89.12954888 989
-89.16612825 989
-89.18174729 1343
-89.22450843 601
-89.35943680 573
-89.90409696 1343
-89.97957753 835
-89.99141718 573
-90.06508001 0
-90.15066168 989
-90.15077132 835
-90.15349857 989
-90.27939103 1343
-90.38490004 53
-90.41361538 53
-90.41382363 53
-90.53635120 989
-90.95636428 573
-91.03879953 601
-91.33555794 1343
-91.38815649 989
-91.46827467 835
-91.54795720 989
-91.55382298 601
-91.55616459 1343
-91.65078601 835
-91.78311277 0
-91.91262541 989
-91.91881532 1343
-92.05497341 53
-92.07143812 53
-92.14973557 0
-92.18350671 573
-92.18673137 0
-92.23611860 53
-92.34912890 601
-92.44415713 573
-92.50345422 53
-92.68664594 835
-92.70742732 1343
-92.99534739 0
-93.00105959 835
-93.07823550 835
-93.14518784 989
-93.59189279 53
-93.60916713 573
-93.64616045 0
-93.78885455 601
-93.85352982 573
-93.89952370 989
-93.92676506 835
-93.99003758 573
-94.03857972 0
-94.09367409 1343
-94.25400944 835
-94.30759074 573
-94.43433419 573
-94.62272658 835
-94.66619415 1343
-94.85214233 989
-94.90149439 989
-94.94206687 0
-95.00335901 989
-95.12359942 53
-95.18024391 835
-95.18128289 573
-95.18509839 835
-95.29364889 1343
-95.32183450 989
-95.37132542 989
-95.39730897 1343
-95.57640604 601
-95.60323007 53
-95.86126586 601
-96.02385075 1343
-96.05861228 989
-96.08053305 573
-96.11568023 1343
-96.12490243 989
-96.12851685 573
-96.24469805 601
-96.49221163 0
-96.56638451 601
-96.59754396 1343
-96.61486178 0
-96.67288589 573
-96.71728767 835
-96.83222592 573
-96.86658308 835
-97.00947021 0
-97.02636947 53
-97.03497427 1343
-97.08369945 989
-97.09776527 601
-97.28109385 53
-97.29602584 989
-97.49338009 601
-97.65467542 573
-97.70412594 573
-97.84844088 573
-97.85848229 573
-98.06653397 573
-98.15364891 573
-98.40836784 53
-98.47394060 1343
-98.77137321 1343
-98.95633171 0
-99.16178872 601
-99.22214287 1343
-99.29209929 0
-99.41237966 53
-99.58462174 989
-99.60015103 1343
-99.83406865 989
-99.88927309 601
-100.03078248 601
-100.03522172 0
-100.08585095 0
-100.14761848 989
-100.21512685 573
-100.21744726 989
-100.22370422 0
-100.22912818 989
-100.27378262 835
-100.38592905 989
-100.39147094 573
-100.44368224 835
-100.54795374 573
-100.56946708 573
-100.75503779 835
-100.84844737 989
-100.96983736 835
-101.00924046 835
-101.12725029 601
-101.20313453 601
-101.24706651 53
-101.53984393 601
-101.54451408 573
-101.78417645 989
-101.80427962 1343
-102.03541254 0
-102.08841708 0
-102.25522797 1343
-102.36167238 0
-102.41601139 835
-102.43770031 53
-102.52448127 573
-102.60225162 601
-102.68427014 601
-102.73893912 1343
-102.75552341 0
-102.76156174 1343
-103.20375645 1343
-103.29030106 53
-103.36643144 989
-103.43523812 989
-103.46953225 1343
-103.48231505 53
-103.94131906 835
-103.96618581 1343
-104.01183596 53
-104.23163416 601
-104.29511287 573
-104.72025163 573
-104.81471812 0
-104.91919541 989
-105.00392720 1343
-105.23057699 573
-105.27885921 0
-105.29234440 601
-105.33028032 0
-105.50019309 601
-105.69825512 53
-105.78770722 0
-105.82938497 573
-105.88901595 989
-105.89333782 1343
-106.07084410 1343
-106.07918654 573
-106.13829613 835
-106.27383809 835
-106.35251093 573
-106.51047176 53
-106.55276038 573
-106.60243229 0
-106.73465363 1343
-107.67470928 0
-107.68704575 835
-107.81858896 573
-107.83155195 601
-107.94367966 0
-107.94830695 0
-107.94927324 835
-108.11767556 0
-108.11937135 53
-108.49083306 989
-108.52615373 1343
-108.70040128 573
-108.77823123 0
-108.83230297 0
-108.83618092 989
-108.84091745 0
-108.84632334 989
-108.93355625 0
-109.03736167 1343
-109.05283906 835
-109.11699587 835
-109.12882565 601
-109.28528137 0
-109.34342553 835
-109.35167414 53
-109.35734767 601
-109.36783506 573
-109.38322658 0
-109.40142812 835
-109.40506520 0
-109.44157157 835
-109.44578697 573
-109.47300770 0
-109.65711376 989
-109.76488326 601
-109.99375193 601
-110.01678183 0
-110.09196712 989
-110.13197582 989
-110.21081478 601
-110.25163586 0
-110.38584912 573
-110.42806424 1343
-110.44197691 601
-110.46780138 989
-110.70866517 1343
-110.74669013 573
-110.81112058 835
-110.84032860 573
-110.94400860 53
-110.95509188 989
-110.97563358 0
-110.99704006 53
-111.02224796 573
-111.10316131 0
-111.15322181 0
-111.16292307 0
-111.16867322 601
-111.22294504 0
-111.23481454 573
-111.51354582 0
-111.66391554 573
-111.66990195 573
-111.72131718 601
-112.02955574 835
-112.05082495 601
-112.07428436 1343
-112.16002211 53
-112.18954397 989
-112.23000964 835
-112.47595296 989
-112.60934088 835
-112.78351225 53
-112.84499933 835
-112.84614712 0
-112.90269654 989
-112.92397948 1343
-112.98739637 0
-113.01086551 601
-113.04626115 0
-113.34716452 1343
-113.35612773 835
-113.38998167 1343
-113.43817831 573
-113.63522484 601
-113.65648836 53
-113.68600728 1343
-113.71812906 835
-113.79322155 989
-113.83454801 53
-113.93009247 573
-114.11580329 573
-114.13336302 1343
-114.19890878 601
-114.20232173 0
-114.30480348 573
-114.39924162 0
-114.73612702 573
-114.76240450 989
-114.94226363 989
-114.98154238 601
-115.05375439 835
-115.22112849 573
-115.40631669 573
-115.45744410 1343
-115.46916701 53
-115.54062760 601
-115.69804283 989
-115.74674847 1343
-115.78829467 0
-115.98417230 601
-116.04317109 0
-116.32527496 989
-116.35254406 1343
-116.35720663 1343
-116.41293073 835
-116.50884277 989
-116.51696686 601
-116.54265266 53
-116.60511643 573
-116.61290799 835
-116.73605621 573
-116.77753690 989
-116.80284678 835
-117.11878653 53
-117.12134270 601
-117.35898689 573
-117.54984764 573
-117.60991319 989
-117.77167482 601
-117.78084735 601
-117.79527455 601
-118.04845772 601
-118.20591081 573
-118.22135367 989
-118.24824324 601
-118.41719151 989
-118.62999430 53
-118.82511502 53
-118.94300191 0
-119.04988376 835
-119.06411930 0
-119.18899177 573
-119.41530786 601
-119.49721300 835
-119.61233680 989
-119.97983013 601
-120.04176376 53
-120.24548125 989
-120.25540555 601
-120.28602673 601
-120.28770549 0
-120.48788660 1343
-120.49952175 0
-120.58435053 601
-120.67163047 573
-120.72200438 53
-120.78969571 1343
-120.97164332 53
-120.99697218 0
-121.06886235 989
-121.20987711 989
-121.21853705 835
-121.23691767 989
-121.35911827 989
-121.54847540 601
-121.79601659 53
-121.97825133 601
-121.99708632 0
-122.00936575 1343
-122.14503070 53
-122.40732499 53
-122.46760337 53
-122.49979964 53
-122.54801044 601
-122.65724659 1343
-122.79515092 989
-122.84853994 0
-122.92178520 1343
-122.95897101 53
-123.03978120 1343
-123.10037374 573
-123.11031399 0
-123.16056769 1343
-123.29821654 53
-123.41606415 0
-123.42017676 0
-123.53871853 1343
-123.64402131 1343
-123.72116172 573
-123.73757820 601
-123.83007607 53
-123.87477011 0
-123.92553920 53
-123.92890716 601
-124.08355264 989
-124.12792378 601
-124.16369676 601
-124.20682003 0
-124.23822810 573
-124.25077071 1343
-124.34217114 0
-124.37176949 989
-124.43036487 0
-124.59804665 0
-124.64605178 601
-124.74295542 601
-124.76432132 989
-124.86324443 835
-124.96456216 1343
-124.99772282 573
-125.06761719 1343
-125.07261731 53
-125.14478391 573
-125.29043482 989
-125.33553019 989
-125.35816531 0
-125.85246192 0
-125.88138833 0
-125.97035956 835
-126.18768233 573
-126.24578326 573
-126.35186754 573
-126.36370355 989
-126.43100184 835
-126.53115727 1343
-126.56975914 1343
-126.64466841 835
-126.71501450 989
-126.75688093 1343
-126.79873331 989
-126.85633665 1343
-126.92707462 1343
-126.97109970 601
-127.11764285 573
-127.12814804 601
-127.24790207 601
-127.32401800 0
-127.40052756 1343
-127.54863264 601
-127.57026565 835
-127.60158823 573
-127.61677799 573
-127.70947327 1343
-127.79859962 989
-127.79985049 601
-127.99250390 573
-128.05589608 0
-128.11242027 573
-128.14788545 601
-128.48388612 989
-128.67929076 573
-128.78888509 1343
-128.85444775 573
-128.94375602 53
-129.08391991 53
-129.09505596 1343
-129.23384499 1343
-129.61736150 1343
-129.67882809 1343
-129.68748948 989
-129.74688829 0
-129.81398701 835
-129.82217958 601
-129.83662567 989
-129.83812499 835
-129.86202378 989
-129.99693237 1343
-130.02188734 601
-130.05005805 989
-130.08061928 989
-130.17079108 0
-130.19723461 1343
-130.30316526 1343
-130.33247037 53
-130.48952680 989
-130.67293014 989
-130.74121897 0
-130.80306023 989
-130.89029979 835
-130.90882578 989
-131.01728808 601
-131.10313303 601
-131.20212708 53
-131.28663067 601
-131.31370184 1343
-131.44639929 835
-131.55544603 835
-131.58870568 989
-131.66058974 835
-131.71880146 53
-131.91965547 53
-131.93619666 53
-132.19638188 835
-132.21174836 601
-132.54081215 601
-132.61600329 0
-132.62780756 53
-132.64732571 1343
-132.67200199 835
-132.75616553 573
-132.81330998 0
-132.88999015 989
-132.97618715 573
-133.11477533 0
-133.19703413 1343
-133.20783114 1343
-133.29564581 1343
-133.37866170 53
-133.47351577 573
-133.48512522 989
-133.52489901 53
-133.57906173 989
-133.62692623 989
-133.65177455 573
-133.70773226 601
-133.90047343 1343
-133.91531100 573
-134.02006182 835
-134.05470597 601
-134.14214563 573
-134.16103886 989
-134.21092354 601
-134.62451373 989
-134.62555695 1343
-134.82423177 835
-134.90451242 53
-134.92682886 601
-134.93158363 601
-134.96597679 53
-135.17099829 0
-135.22214487 989
-135.22470874 53
-135.25152143 0
-135.44871829 0
-135.60492542 573
-135.60746907 601
-135.63499132 0
-135.65188558 0
-135.66246801 1343
-135.78062498 1343
-135.85581937 1343
-135.92823769 989
-135.94983695 835
-136.18639390 53
-136.26531048 835
-136.35163780 835
-136.51380622 1343
-136.58531885 835
-136.60632881 1343
-136.78357499 1343
-136.80878997 1343
-136.89467867 1343
-137.05294191 835
-137.22604844 53
-137.26492644 53
-137.30634767 1343
-137.33409342 0
-137.46515449 601
-137.47913779 1343
-137.71402801 989
-137.82169101 601
-137.82184821 601
-137.91069397 0
-137.91706442 989
-138.07465545 989
-138.25125370 1343
-138.26600500 835
-138.30216639 0
-138.32055999 601
-138.58469889 53
-138.62119645 53
-138.76100492 989
-138.76917017 0
-138.76943711 0
-138.83426717 53
-138.97743861 989
-139.10163109 573
-139.10327398 573
-139.16112102 53
-139.26877978 1343
-139.27413312 573
-139.29983607 0
-139.38877706 53
-139.41449190 53
-139.52679042 0
-139.53196513 0
-139.55693060 989
-139.64071723 0
-139.64158227 53
-139.67965224 1343
-140.01421998 835
-140.02965414 573
-140.13050570 0
-140.23850782 601
-140.23971873 1343
-140.34298144 1343
-140.40077580 0
-140.50640739 989
-140.60461710 989
-140.87308616 53
-140.99445706 601
-141.02547029 835
-141.24729696 601
-141.33750667 601
-141.33927787 1343
-141.37491427 989
-141.39201110 573
-141.45888999 53
-141.71548125 0
-141.95991660 989
-142.01695028 53
-142.02530562 53
-142.05870471 53
-142.30516473 573
-142.57285180 989
-142.57384549 835
-142.58576321 835
-142.79016379 989
-143.05673349 0
-143.09052161 989
-143.12115101 53
-143.13732996 1343
-143.23001803 1343
-143.30710821 53
-143.40781397 1343
-143.41246543 1343
-143.57247368 601
-143.60230573 835
-143.61057866 989
-143.63162605 1343
-143.64483888 0
-143.69617151 835
-143.80105508 989
-143.82432030 601
-143.82449023 0
-143.85103047 573
-143.87083937 53
-143.95545971 989
-144.02835146 835
-144.06033915 573
-144.08659943 1343
-144.15773623 573
-144.51303787 989
-144.88695457 0
-145.03867527 53
-145.14575887 601
-145.21933039 0
-145.30949552 989
-145.31857174 573
-145.32106366 601
-145.33105629 835
-145.34006805 1343
-145.76265325 573
-145.85473761 53
-146.16470450 53
-146.18555214 53
-146.24454365 601
-146.29845424 989
-146.38057214 835
-146.40358973 53
-146.42076783 835
-146.60465052 989
-146.73502636 989
-146.82756170 0
-146.90057898 835
-146.90239280 0
-146.90617861 835
-147.11513102 835
-147.15451760 1343
-147.17695108 1343
-147.33880967 601
-147.38478670 53
-147.40717283 0
-147.48347944 1343
-147.60971837 1343
-147.64828275 1343
-147.67603813 573
-147.78478698 835
-147.86459554 53
-147.89183784 989
-148.06701227 989
-148.25216798 53
-148.26458315 0
-148.33111332 0
-148.43731150 53
-148.46769248 601
-148.51244633 0
-148.59922227 989
-148.67749488 573
-148.70187106 53
-148.81020003 53
-148.89251061 601
-148.93450771 1343
-149.18065536 989
-149.22159322 835
-149.48237305 0
-149.52736032 573
-149.58923315 601
-149.62886247 53
-149.67953954 53
-149.74095348 53
-149.81422785 601
-149.82361304 0
-149.95382415 601
-150.01487450 573
-150.05924473 53
-150.06436535 53
-150.06842175 53
-150.10920886 1343
-150.12279642 53
-150.19508678 835
-150.22371763 0
-150.26225890 1343
-150.26229902 835
-150.27727368 989
-150.32291947 601
-150.32655575 0
-150.40581533 1343
-150.47103346 0
-150.60177849 601
-150.71736931 601
-150.71754265 601
-150.74125313 1343
-150.76476757 601
-150.77834624 1343
-150.83879586 0
-150.94170264 53
-150.95823929 573
-151.09293629 53
-151.26001386 53
-151.32211170 573
-151.42799326 1343
-151.50253417 53
-151.57888804 573
-151.66504560 601
-151.70296307 53
-151.88156067 1343
-151.88920999 835
-151.94997425 53
-151.98565524 601
-152.02667135 989
-152.20810397 835
-152.22936912 1343
-152.26073399 1343
-152.60702571 989
-152.67075263 989
-152.67506314 0
-152.82815692 601
-152.85359649 1343
-152.93062919 601
-153.05234022 1343
-153.12781916 0
-153.45792962 835
-153.46748567 989
-153.46891338 53
-153.63647241 1343
-153.66478223 989
-153.68334047 1343
-153.71845454 835
-153.85428151 601
-153.92809266 989
-154.20206196 601
-154.28229614 601
-154.33233592 1343
-154.40839918 989
-154.43891874 0
-154.47626685 53
-154.64101914 989
-154.65125902 1343
-154.78352599 53
-154.84112120 573
-154.85220192 53
-155.00995990 601
-155.13204737 1343
-155.18170931 601
-155.29622674 1343
-155.45797732 0
-155.49357373 573
-155.59422070 1343
-155.63124806 989
-155.63682656 573
-155.67043500 601
-155.79031556 573
-155.87053712 989
-155.91865503 835
-155.99254493 835
-155.99639058 835
-156.17556650 1343
-156.19083933 573
-156.20764138 0
-156.40449666 835
-156.46391276 989
-156.47853010 601
-156.52152528 53
-156.53198290 601
-156.64895383 989
-156.78968002 573
-156.81689969 1343
-156.86887417 835
-156.95210637 601
-157.18288751 0
-157.44509095 835
-157.53015832 0
-157.88915888 835
-158.10774018 0
-158.23037910 1343
-158.34082551 573
-158.37847590 989
-158.39983152 1343
-158.40517460 601
-158.47776173 0
-158.49891875 573
-158.62915808 0
-158.96426164 0
-159.13111560 601
-159.22400970 573
-159.34915887 1343
-159.87886966 0
-159.88561801 1343
-160.21605391 835
-160.22162028 601
-160.24530134 573
-160.26194721 835
-160.32894555 989
-160.37587223 601
-160.69294097 835
-160.70122754 989
-160.72409498 53
-160.96735138 1343
-160.97662713 53
-160.99494965 573
-161.28682967 989
-161.33049542 573
-161.47299516 1343
-161.64213852 835
-161.81796837 601
-161.84327362 835
-161.92343009 0
-161.96127727 53
-161.96372122 53
-162.10283147 53
-162.14911007 573
-162.19872557 989
-162.26394777 1343
-162.32474707 835
-162.37719981 53
-162.41859200 1343
-162.48030097 989
-162.62634208 573
-162.64670091 0
-162.67738553 573
-162.70970208 1343
-162.75186007 1343
-162.76813151 835
-162.81432510 835
-162.83209423 573
-162.84532225 835
-162.86847630 53
-162.94046751 0
-162.94057522 573
-163.02606653 53
-163.14567041 0
-163.21979577 573
-163.35451019 1343
-163.35777242 835
-163.51984151 53
-163.57510820 601
-163.65567691 573
-163.77884300 573
-163.83444633 573
-163.90523382 573
-163.94895831 989
-163.98512306 53
-164.30434740 1343
-164.33139727 0
-164.40160391 601
-164.41648476 53
-164.47020146 601
-164.47791588 573
-164.51519425 1343
-164.52691800 573
-164.66574351 0
-164.85486598 835
-165.12502738 573
-165.21115081 53
-165.24382412 601
-165.30787633 989
-165.40791356 835
-165.43539909 573
-165.45062314 0
-165.55733349 1343
-165.77110920 989
-165.78021752 989
-165.84368636 1343
-165.85754477 0
-165.87501202 989
-165.90896258 989
-165.97794945 835
-166.06182219 0
-166.08378826 989
-166.21209702 835
-166.29874792 0
-166.35804584 601
-166.54450905 573
-166.75172789 53
-166.77955943 53
-166.80564348 989
-166.92693300 601
-166.95608605 573
-167.08097460 1343
-167.19878449 53
-167.43392115 573
-167.63707337 835
-167.68266492 989
-167.75413298 0
-167.94634607 989
-167.99546424 1343
-167.99750792 835
-168.01779416 53
-168.03695073 601
-168.06592183 1343
-168.21362687 573
-168.46303093 989
-168.48422526 1343
-168.73932141 835
-168.79373092 53
-168.86046942 53
-169.09961905 573
-169.10832867 989
-169.24378399 573
-169.30297492 989
-169.36370903 0
-169.39964909 0
-169.42006473 573
-169.43215334 835
-169.50918138 601
-169.52433702 573
-169.60348289 0
-169.60927395 835
-169.72572522 989
-169.74455591 573
-169.77138582 835
-169.78425861 601
-170.00947881 835
-170.06612912 989
-170.13648240 1343
-170.29362404 601
-170.36052721 835
-170.43591189 835
-170.65548915 601
-170.71090404 53
-170.74762994 573
-170.78591469 1343
-170.80737985 989
-170.85297345 0
-170.86581985 53
-170.88158388 53
-170.92936222 601
-170.93732283 1343
-171.11016546 835
-171.17250939 989
-171.19226761 601
-171.23191755 601
-171.41621216 601
-171.44135130 573
-171.53504952 573
-171.64195886 835
-171.73721749 1343
-171.76929225 0
-171.79542434 835
-171.81011845 989
-171.96067907 53
-171.96238413 601
-171.99461455 0
-172.10325964 573
-172.12191091 53
-172.12718152 1343
-172.22814665 1343
-172.23895987 53
-172.36976334 989
-172.43101104 0
-172.60377990 989
-172.63653269 53
-172.74967808 53
-172.85868333 1343
-172.86331866 53
-172.90499469 0
-172.95639276 573
-173.00296947 989
-173.04107916 573
-173.04383613 53
-173.14730150 601
-173.17473195 0
-173.21027893 0
-173.31483935 0
-173.39500523 601
-173.55184891 989
-173.71083549 989
-173.78328760 989
-173.78794673 601
-174.06372923 1343
-174.06381758 835
-174.06995483 53
-174.30110712 989
-174.38927817 601
-174.42139682 53
-174.51423801 989
-174.84612002 1343
-174.87122216 835
-174.88562160 835
-174.94482697 573
-174.98610696 573
-175.21669712 573
-175.23161232 573
-175.39570146 601
-175.54344162 0
-175.54677041 601
-175.65499543 573
-175.65524136 835
-176.04981756 53
-176.11849726 989
-176.19235999 0
-176.34206052 53
-176.35607786 989
-176.47889235 989
-176.57235500 601
-176.69101289 835
-176.69225532 53
-176.76304495 1343
-176.89686641 0
-176.90221868 0
-176.92618147 0
-177.27554093 573
-177.50238197 601
-177.50469049 989
-177.55315418 0
-177.57073478 53
-177.60205457 53
-177.68427632 989
-177.71366338 835
-177.72702042 601
-177.86288172 53
-178.64531413 601
-178.72602342 573
-178.73989673 1343
-178.77562236 573
-178.79255856 0
-178.79686189 835
-178.81780032 0
-178.86050491 601
-178.86963027 53
-178.87375034 573
-178.88999580 1343
-178.89249528 989
-178.94225356 53
-178.96145389 835
-178.99391560 573
-179.13502684 573
-179.16844167 1343
-179.23654830 601
-179.33478357 989
-179.39625490 0
-179.74947069 1343
-179.89491489 0
-179.91486384 53
@@ -1,1419 +0,0 @@
-10.18906709 601
-10.29359858 601
-10.32665418 53
-10.73259095 1343
-10.87419131 989
-10.97543173 1343
-11.02348461 1343
-11.06057952 989
-11.15449789 573
-11.17892626 835
-11.31824386 0
-11.49763290 989
-11.53696776 573
-11.68683488 1343
-11.70975848 573
-11.75362814 835
-12.01868731 573
-12.02323842 573
-12.05747936 1343
-12.26505011 573
-12.34231047 601
-12.45583240 0
-12.72091555 989
-12.80773043 601
-12.84895830 0
-12.91028193 1343
-13.05939844 573
-13.09575919 601
-13.31357594 0
-13.38671595 989
-13.41073591 573
-13.49047744 0
-13.58685371 989
-13.62051051 835
-13.64478036 601
-13.84467267 573
-14.03074055 989
-14.07804182 0
-14.45069256 573
-14.65551741 989
-14.71238246 835
-14.73379855 53
-14.77474556 53
-14.99281662 573
-15.17371255 0
-15.53586796 601
-15.56451109 989
-15.83595734 573
-15.84177107 835
-15.97222724 989
-15.99035774 835
-16.44993066 601
-16.55596159 835
-16.60605212 601
-17.06264324 989
-17.34343538 573
-17.65540060 573
-17.70917546 601
-17.80881999 0
-17.88062177 835
-18.02422490 989
-18.19270737 601
-18.28522638 835
-18.31738744 601
-18.32920223 0
-19.52719921 989
-19.61990806 601
-20.51628856 989
-20.74630254 989
-20.90241996 835
-21.03775538 601
-21.06371424 0
-21.11246766 1343
-21.21580759 989
-21.27157079 601
-21.27264607 53
-21.37434049 53
-21.59572755 0
-21.62703069 989
-21.67737646 835
-21.69565278 573
-21.96682820 989
-22.06560753 989
-22.29909912 835
-22.54674626 53
-22.55505319 1343
-22.63665239 835
-22.65106411 53
-22.81887360 0
-22.84016001 1343
-23.09303082 573
-23.20991695 1343
-23.26636237 835
-23.27301556 989
-23.42209191 573
-23.55598630 573
-23.69420861 989
-23.71807918 53
-23.88511184 835
-24.00870793 601
-24.10419062 573
-24.15075158 573
-24.28444146 53
-24.31682666 0
-24.41843497 601
-24.50078178 601
-24.77271694 0
-24.90613744 0
-25.07799242 0
-25.11236543 601
-25.25312067 989
-25.30634606 989
-25.38957176 601
-25.40855104 601
-25.61836219 0
-25.72402530 835
-25.84909400 0
-25.88370736 989
-25.89988308 835
-26.02221916 835
-26.08249269 601
-26.13556658 989
-26.44839555 0
-26.52254288 53
-26.63990028 835
-26.79201229 989
-26.80068269 53
-27.15050671 53
-27.15070426 989
-27.26648002 0
-27.32384817 835
-27.40954227 53
-27.42400221 1343
-27.99310337 601
-28.06191351 835
-28.21764358 1343
-28.22488582 601
-28.68603295 0
-28.74090039 601
-28.74105199 989
-28.83764726 0
-29.16705425 573
-29.20397731 601
-29.28401456 1343
-29.39572022 989
-29.81589784 989
-29.91023167 0
-30.05448778 573
-30.10336885 835
-30.18640725 53
-30.27481211 835
-30.61000778 989
-30.61311297 601
-30.71323782 989
-30.82255285 53
-30.82693441 835
-30.84014940 1343
-30.98247574 989
-31.22047847 601
-31.31115560 0
-31.35071780 601
-31.40291987 573
-31.48439763 0
-31.51568699 53
-31.55651479 601
-31.57726207 601
-31.83951892 601
-32.02042644 601
-32.38714944 53
-32.56336651 1343
-32.68057789 989
-32.69645501 601
-32.73167404 989
-32.77204558 989
-32.78086299 0
-32.86244944 573
-33.13344209 53
-33.28803046 1343
-33.34527366 835
-33.79881289 0
-33.91894463 573
-34.09998076 0
-34.15384753 53
-34.24088034 601
-34.44802985 1343
-34.46790421 573
-34.49118368 573
-34.49430580 53
-34.54965186 0
-34.60491996 835
-34.72850017 53
-34.95900552 53
-34.96870550 573
-34.98970303 53
-35.08377920 989
-35.14510788 53
-35.15725067 0
-35.30433916 989
-35.31205604 0
-35.36922599 573
-35.43769872 835
-35.49625031 53
-35.52965472 53
-35.54376476 1343
-35.61946832 0
-35.65151933 835
-35.70796311 835
-35.73107750 573
-35.80523285 835
-35.82767406 601
-36.06979893 989
-36.08538081 835
-36.09225676 1343
-36.72113182 835
-36.73533557 835
-37.15272084 53
-37.32239527 601
-37.48216098 1343
-37.53216943 0
-37.55156798 601
-37.57989940 601
-37.69514033 989
-37.70684159 53
-37.72437996 0
-37.76587214 573
-37.91786179 1343
-37.94128438 0
-38.02347249 573
-38.12165978 601
-38.41805455 601
-38.54258583 601
-38.62718128 989
-38.96934778 1343
-39.04488795 53
-39.05368697 1343
-39.09317408 0
-39.30122744 53
-39.35211092 835
-39.83941413 0
-39.94070196 0
-40.10822128 601
-40.25487085 573
-40.30532485 573
-40.31323667 573
-40.53081411 1343
-40.75377820 53
-40.81634190 1343
-40.86230021 989
-40.89311594 0
-41.03426751 989
-41.07974892 989
-41.20581582 601
-41.24836857 573
-41.34557948 601
-41.40265873 573
-41.70705530 0
-41.72555791 835
-42.50872365 989
-42.64865950 835
-42.68415107 573
-42.73940714 573
-42.77060238 601
-42.89070995 53
-42.95749327 53
-43.08519064 1343
-43.23313348 53
-43.29043821 1343
-43.43657071 835
-43.76169146 1343
-43.79407482 601
-44.54318508 989
-44.60368837 835
-44.83109829 1343
-44.83422949 601
-44.86293945 53
-44.98318967 53
-45.08410977 835
-45.10101904 1343
-45.30743477 601
-45.31248875 989
-45.45415487 0
-45.52069726 1343
-45.56501557 573
-46.05694740 835
-46.16685454 0
-46.33253230 601
-46.71853136 53
-46.86627600 835
-46.88716818 601
-47.08372934 1343
-47.14958915 601
-47.15324061 1343
-47.26664987 601
-48.12992521 53
-48.29945699 0
-48.32593079 835
-48.42250337 0
-48.48731755 601
-48.51284622 573
-48.56359519 601
-49.01560872 835
-49.09564993 601
-49.30228421 0
-49.42626028 989
-49.49408632 573
-49.57003789 835
-49.61492272 601
-49.79240835 573
-49.99504423 601
-50.14908751 573
-50.22258447 601
-50.31903701 0
-50.51765239 601
-50.55963328 1343
-50.64493678 573
-50.91070645 1343
-51.06297992 989
-51.18816250 0
-51.23481753 0
-51.43721774 835
-51.44630394 0
-51.59780422 601
-51.67673859 1343
-51.87550954 1343
-51.92824441 989
-52.08118992 0
-52.09388527 835
-52.32509968 573
-52.39464048 1343
-52.45772692 573
-52.47090775 835
-52.50370727 989
-52.54781056 601
-52.58946868 0
-52.59498269 573
-52.91184408 989
-53.02190914 601
-53.28145009 53
-53.68934098 573
-53.98065242 835
-54.00234932 601
-54.15852348 0
-54.25741411 989
-54.34382373 601
-54.37282528 601
-54.49168489 0
-54.49388364 835
-54.63428114 601
-54.65769385 0
-54.91001017 573
-54.95677879 573
-54.99852864 601
-55.05187358 835
-55.16477648 53
-55.20028960 989
-55.22670797 573
-55.66160815 0
-56.02498317 573
-56.16688629 0
-56.18906164 0
-57.66426631 1343
-57.87228863 53
-57.92346736 601
-58.03619279 835
-58.06727229 1343
-58.34534553 53
-58.41856230 573
-58.97887350 989
-59.10136769 53
-59.57892169 1343
-59.61601284 573
-60.03276928 0
-60.20334081 601
-60.48529728 53
-60.66508909 601
-60.67366526 601
-60.70932155 1343
-60.78032919 835
-60.81525852 601
-60.88974552 573
-61.03727512 0
-61.05249713 0
-61.38609358 835
-61.74727437 0
-61.75533023 835
-61.91049707 989
-62.07796190 835
-62.68666347 989
-62.73005441 53
-62.85679697 0
-63.21684200 989
-63.22189796 1343
-63.39986453 1343
-63.52299824 989
-63.55389880 601
-63.65426976 1343
-63.65882576 0
-63.79118849 0
-64.03459165 835
-64.14152497 53
-64.22025751 53
-64.76476317 53
-65.21853991 53
-65.25089247 601
-65.32348805 1343
-65.51011417 601
-65.53656635 53
-65.56831417 835
-65.75245805 573
-65.79552276 989
-65.88490686 573
-65.90881023 53
-66.09033908 53
-66.16410279 573
-66.30080195 0
-66.39410263 573
-66.48686500 835
-66.56563625 0
-66.62361612 989
-66.80874001 601
-66.82667805 0
-66.83116107 0
-66.94827817 601
-66.96474406 835
-67.18679720 601
-67.31265112 1343
-67.44161868 835
-67.53336589 0
-67.81235881 601
-67.85354012 573
-67.98587926 53
-68.07977170 53
-68.15347170 835
-68.45631010 53
-68.47509251 989
-68.62318730 573
-68.71917653 53
-68.73577053 989
-68.76199163 989
-69.07041325 835
-69.07599472 53
-69.19821278 53
-69.25682491 573
-69.25864300 989
-69.26966229 1343
-69.29158487 1343
-69.33240683 0
-69.61426102 835
-69.72932950 989
-69.79451382 601
-69.98491073 1343
-70.14760468 573
-70.18441860 989
-70.23526193 1343
-71.10155675 1343
-71.19775662 989
-71.21645757 989
-71.21746976 53
-71.36711446 1343
-71.56694411 0
-71.59963163 0
-71.72254396 53
-71.77155150 835
-71.83919328 835
-72.02962390 989
-72.09843494 601
-72.41133360 989
-72.93364088 989
-73.03427723 573
-73.19375715 835
-73.21234636 573
-73.40728911 53
-73.98363491 0
-74.00101397 601
-74.02760953 835
-74.08901330 573
-74.11214729 989
-74.13340283 53
-74.21296117 601
-74.35848869 989
-74.69611270 53
-74.71097557 0
-74.92720354 835
-75.01674451 601
-75.11643069 53
-75.12551388 601
-75.18069700 601
-75.25444938 0
-75.40228765 1343
-75.67577301 1343
-75.68480876 989
-75.70155111 0
-75.70481728 1343
-75.70917130 835
-75.90312900 835
-75.93613879 53
-76.01252752 53
-76.08508305 53
-76.37795907 0
-76.48847182 53
-76.50643463 835
-76.60955568 53
-76.63442734 1343
-76.77495367 573
-76.93042391 989
-76.96577891 1343
-76.98498922 1343
-77.03033609 601
-77.16518519 835
-77.18156966 989
-77.24364247 989
-77.32290591 0
-77.37516870 601
-77.48997460 53
-77.57628143 835
-77.77133834 835
-77.82924404 573
-77.88852633 53
-78.04341646 835
-78.04819542 1343
-78.10137569 573
-78.15763358 989
-78.30141809 989
-78.30905562 53
-78.32480721 989
-78.66519121 573
-78.70976959 989
-78.84904888 0
-78.96900167 601
-79.06932012 989
-79.30649898 573
-79.39551017 989
-79.54662363 573
-79.84183414 53
-79.86022045 53
-80.02739070 0
-80.03794387 601
-80.28301307 835
-80.34375062 989
-80.53702840 989
-80.59936210 1343
-80.60621311 573
-80.65663913 0
-80.72032620 601
-80.77099926 0
-80.94005013 989
-80.96171765 989
-81.08000159 573
-81.09408285 53
-81.19828117 601
-81.58704307 1343
-81.64473834 835
-81.65263206 573
-81.77497939 0
-81.86109725 835
-81.88323922 0
-82.41142435 1343
-82.42536143 53
-82.44572755 573
-82.69830832 1343
-82.70875502 0
-82.96861738 601
-83.35129390 1343
-83.40468859 835
-83.42242030 989
-83.45647794 1343
-83.53608399 1343
-83.55721586 573
-83.67596826 1343
-83.71153903 53
-83.77459388 989
-83.78012286 601
-84.04701191 53
-84.18402015 573
-84.37033310 1343
-84.72354432 0
-84.74168187 573
-84.97636395 53
-85.11888267 0
-85.26694496 835
-85.41229734 0
-85.47967264 573
-85.53922062 835
-85.65116843 1343
-85.72605485 989
-85.72892709 835
-85.97008968 0
-86.00442819 989
-86.02866171 1343
-86.11110457 989
-86.18159054 53
-86.23283968 573
-86.47419543 53
-86.57737036 0
-86.67958767 1343
-86.73997236 1343
-86.89519997 573
-86.96091545 601
-87.00099251 573
-87.13433969 835
-87.26998267 0
-87.59655479 601
-87.90763770 53
-87.94517622 0
-87.95465157 601
-87.99258587 573
-88.36305132 601
-88.39535345 0
-88.51593408 0
-88.68036955 573
-88.73820613 0
-88.78231050 1343
-88.82598524 53
-88.93862823 53
-88.99882179 601
-89.04309724 573
-89.19026559 835
-89.39597481 0
-89.40020592 601
-89.48231487 573
-89.74427375 53
-90.16707759 989
-90.25123632 573
-90.46752355 53
-90.50276295 835
-90.62539196 573
-90.69698066 1343
-91.46437379 989
-91.50658611 53
-91.72790660 573
-92.17667725 835
-92.21382082 573
-92.21972651 835
-92.22191765 989
-92.24812967 53
-92.35422866 835
-92.40548589 835
-92.45573356 573
-92.75370710 53
-92.80588462 0
-92.90891864 573
-92.94219470 601
-93.25511329 835
-93.44655298 573
-93.46759531 1343
-93.47763227 1343
-93.49587283 835
-93.54264316 601
-93.58068768 601
-93.63889897 53
-93.68638990 835
-93.88512833 0
-94.18289774 835
-94.90860418 573
-95.02776692 0
-95.23981802 53
-95.44377116 573
-95.54955719 989
-95.80767113 835
-95.86697177 53
-95.98246221 573
-96.00310730 835
-96.18003709 573
-96.36650018 1343
-97.02792568 835
-97.15581037 989
-97.28644228 989
-97.48413245 573
-98.23986995 573
-98.29278450 0
-98.37920077 601
-98.38484334 53
-98.54114586 835
-98.88394862 835
-99.02207985 0
-99.05954279 0
-99.17417347 989
-99.97233818 835
-99.99177617 573
-100.07257361 0
-100.27034872 1343
-100.39133215 53
-100.42279612 53
-100.53878243 989
-100.95154225 573
-101.03890291 601
-101.33412047 1343
-101.38479830 989
-101.47062123 835
-101.54756890 989
-101.56446997 1343
-101.65622731 835
-101.78376869 0
-101.91231148 989
-101.91712778 1343
-102.04925250 53
-102.17770930 573
-102.19313948 0
-102.24563234 53
-102.35019214 601
-102.44411101 573
-102.50807995 53
-102.70638528 1343
-102.99822048 0
-103.08814611 835
-103.58848314 53
-103.65357832 0
-103.79541755 601
-103.84738582 573
-103.90516443 989
-103.93449859 835
-103.98460393 573
-104.03202650 0
-104.09981783 1343
-104.61893001 835
-104.85993638 989
-104.90439160 989
-104.93742737 0
-104.99990727 989
-105.12181806 53
-105.17953670 835
-105.30099822 1343
-105.32309517 989
-105.36195251 989
-105.39847856 1343
-105.56800229 601
-105.60458686 53
-105.87071854 601
-106.02410952 1343
-106.05976578 989
-106.08340019 573
-106.10674949 1343
-106.13227546 989
-106.24062013 601
-106.50191378 0
-106.57089482 601
-106.67861778 573
-106.71999591 835
-106.83721480 573
-106.85946545 835
-107.03810105 1343
-107.28586525 53
-107.30035005 989
-107.48983264 601
-107.65820190 573
-107.69622854 573
-107.84973809 573
-108.07534738 573
-108.15326527 573
-108.39922131 53
-108.47147107 1343
-108.76530525 1343
-108.96479998 0
-109.15851149 601
-109.21714527 1343
-109.28410492 0
-109.59266812 989
-109.59587636 1343
-109.88301554 601
-110.04429279 0
-110.20676649 573
-110.20981777 989
-110.22116796 989
-110.22943313 0
-110.27477307 835
-110.37710935 989
-110.39563456 573
-110.55576554 573
-110.56655337 573
-110.75244784 835
-110.85315714 989
-111.00533730 835
-111.13699594 601
-111.19381727 601
-111.25445010 53
-111.53329536 601
-111.79149169 989
-111.80758640 1343
-112.03428323 0
-112.08076202 0
-112.26038557 1343
-112.35876128 0
-112.44173682 53
-112.60625864 601
-112.67807604 601
-112.76229369 1343
-113.20090619 1343
-113.29307386 53
-113.36254903 989
-113.43646892 989
-113.46923887 1343
-113.47758194 53
-113.93307041 835
-113.95623556 1343
-114.23673575 601
-114.28903550 573
-114.72389773 573
-114.81158708 0
-114.92052934 989
-115.00109096 1343
-115.22952136 573
-115.29049101 601
-115.32733101 0
-115.49790782 601
-115.78642063 0
-115.83664795 573
-115.88200896 989
-115.90057171 1343
-116.07041544 1343
-116.07709161 573
-116.13338468 835
-116.27224773 835
-116.34528206 573
-116.50348841 53
-116.54922768 573
-116.59974947 0
-116.73694315 1343
-117.67823571 0
-117.69415524 835
-117.81074979 573
-117.93598891 0
-117.95641179 0
-117.95821047 835
-118.10947293 53
-118.49381427 989
-118.52829866 1343
-118.69534882 573
-118.83279325 0
-118.83689546 989
-118.83940039 989
-118.94282678 0
-119.04303589 1343
-119.05486950 835
-119.33452263 835
-119.34935781 53
-119.36194634 573
-119.36636853 601
-119.39612243 835
-119.39818745 0
-119.44232748 835
-119.46479367 0
-119.64861651 989
-119.75815448 601
-120.01749296 0
-120.09184351 989
-120.20792277 601
-120.24555804 0
-120.38948113 573
-120.42015147 1343
-120.43259475 601
-120.46427046 989
-120.81431052 835
-120.83466074 573
-120.94092901 53
-120.95421093 989
-120.99793172 53
-121.17780854 601
-121.22354134 0
-121.52177185 0
-121.65660909 573
-121.67405459 573
-121.71279868 601
-122.03266548 835
-122.15150081 53
-122.19579745 989
-122.23711558 835
-122.77732466 53
-122.84491831 835
-122.84884643 0
-122.91407978 1343
-122.99546561 0
-123.01992501 601
-123.05078847 0
-123.35147868 1343
-123.36114260 835
-123.39701586 1343
-123.71842273 835
-123.82533013 53
-123.92013510 573
-124.10786401 573
-124.13928625 1343
-124.19264102 0
-124.19672476 601
-124.30797368 573
-124.77062159 989
-124.94810286 989
-125.22403074 573
-125.40174410 573
-125.47108692 53
-125.53174228 601
-125.70020885 989
-125.75482145 1343
-125.79243332 0
-126.03604375 0
-126.31830762 989
-126.34788610 1343
-126.35816822 1343
-126.51560307 989
-126.52012192 601
-126.74387455 573
-126.78246016 989
-126.80855788 835
-127.34913985 573
-127.55109657 573
-127.78637878 601
-128.04504810 601
-128.21308374 989
-128.24877999 601
-128.41776965 989
-128.63626125 53
-128.82930121 53
-129.05774136 0
-129.18983714 573
-129.41928910 601
-129.50183441 835
-129.61824351 989
-129.97702488 601
-130.04038244 53
-130.25367465 601
-130.28430773 0
-130.29599205 601
-130.49441594 1343
-130.67422574 573
-130.78827500 1343
-131.07806896 989
-131.21966555 989
-131.22353826 835
-131.54590260 601
-131.97631087 601
-132.00263338 0
-132.15455868 53
-132.40701536 53
-132.46973861 53
-132.49687861 53
-132.84234388 0
-132.92265146 1343
-132.95199652 53
-133.10489907 573
-133.11447572 0
-133.16692040 1343
-133.29110406 53
-133.64216708 1343
-133.72539272 573
-133.73382447 601
-133.83158785 53
-133.87467533 0
-133.91981567 53
-134.12682810 601
-134.15850114 601
-134.20468315 0
-134.24592257 573
-134.26004262 1343
-134.37416897 989
-134.42269134 0
-134.64417686 601
-134.74840438 601
-134.75911953 989
-134.85472864 835
-134.95618044 1343
-135.07271294 53
-135.14747819 573
-135.34127986 989
-135.36752094 0
-135.84562808 0
-135.87764738 0
-135.96502785 835
-136.36878442 989
-136.52757887 1343
-136.56431476 1343
-136.63777669 835
-136.71230015 989
-136.79771381 989
-136.92384417 1343
-137.11335672 573
-137.13507197 601
-137.25753702 601
-137.31456292 0
-137.40763297 1343
-137.55691413 601
-137.57001685 835
-137.60499894 573
-137.61209500 573
-137.79328003 989
-137.98269810 573
-138.12137727 573
-138.49367171 989
-138.79527459 1343
-138.84658919 573
-139.08571412 53
-139.09438132 1343
-139.22919193 1343
-139.61813465 1343
-139.68617950 1343
-139.69720970 989
-139.74768348 0
-139.81730147 601
-139.83354631 989
-140.01400789 601
-140.05222742 989
-140.20589205 1343
-140.31315620 1343
-140.33280851 53
-140.49290568 989
-140.67027410 989
-140.80620642 989
-140.88188480 835
-140.90616145 989
-141.02590996 601
-141.11175192 601
-141.29180457 601
-141.30581616 1343
-141.59675707 989
-141.65066845 835
-141.71197830 53
-141.92672955 53
-141.92886259 53
-142.20515948 601
-142.54552606 601
-142.61193226 0
-142.63975468 1343
-142.66530408 835
-142.75707247 573
-142.81907016 0
-142.89254807 989
-143.10962748 0
-143.19012428 1343
-143.20570532 1343
-143.30058793 1343
-143.48521486 989
-143.53234245 53
-143.58633447 989
-143.90767375 573
-143.90844621 1343
-144.01367752 835
-144.13628227 573
-144.17073603 989
-144.62639534 1343
-144.63445893 989
-144.91368171 53
-144.92029591 601
-144.93586679 601
-144.96702713 53
-145.22269315 989
-145.23328724 53
-145.24416135 0
-145.43998220 0
-145.61232125 601
-145.63138660 0
-145.65189381 0
-145.66311046 1343
-145.78140797 1343
-145.86495465 1343
-145.92499658 989
-145.95633191 835
-146.19609441 53
-146.27196553 835
-146.52041438 1343
-146.60986523 1343
-146.78475267 1343
-146.89269927 1343
-147.06102889 835
-147.23424198 53
-147.26450812 53
-147.30858746 1343
-147.33934760 0
-147.46192282 601
-147.47159625 1343
-147.71003746 989
-147.82174209 601
-147.82546906 601
-147.91025227 989
-147.91860562 0
-148.08287085 989
-148.25216115 1343
-148.25927513 835
-148.29763245 0
-148.31190020 601
-148.57991895 53
-148.76749385 0
-148.76962790 989
-148.82598167 53
-149.10770116 573
-149.26259262 1343
-149.29708347 0
-149.38508344 53
-149.53169783 0
-149.53895445 0
-149.55705602 989
-149.63751860 53
-149.67809108 1343
-150.01283554 835
-150.23842945 1343
-150.24037599 601
-150.34533695 1343
-150.40451252 0
-150.51211502 989
-150.87192496 53
-150.98978713 601
-151.02218136 835
-151.25452069 601
-151.34771820 1343
-151.37932735 989
-151.39615176 573
-151.46157834 53
-151.72456975 0
-152.01665489 53
-152.30095598 573
-152.57930930 835
-152.58235056 989
-153.09514510 989
-153.11765600 53
-153.31274274 53
-153.40886224 1343
-153.42054507 1343
-153.61132129 835
-153.61222345 989
-153.63892363 0
-153.70174900 835
-153.80108516 989
-153.81640135 0
-153.82181646 601
-153.84168884 573
-153.87362504 53
-153.95539494 989
-154.02248127 835
-154.06140608 573
-154.16463518 573
-154.51254220 989
-155.14678218 601
-155.21481858 0
-155.31652483 601
-155.32777265 835
-155.84580529 53
-156.25336460 601
-156.30565126 989
-156.38450899 835
-156.40931118 53
-156.42461123 835
-156.73829461 989
-156.89059904 835
-156.89655923 835
-156.90537452 0
-157.16022739 1343
-157.16930859 1343
-157.33962902 601
-157.38777532 53
-157.49238443 1343
-157.67982168 573
-157.86643939 53
-157.90106751 989
-158.06347987 989
-158.25121460 53
-158.26313736 0
-158.43256625 53
-158.47307210 601
-158.51515575 0
-158.70491975 53
-158.80513173 53
-158.89081946 601
-159.17456569 989
-159.21625575 835
-159.47935887 0
-159.52759999 573
-159.59487399 601
-159.62108198 53
-159.68415880 53
-159.74516559 53
-159.80874962 601
-159.82792217 0
-160.01549255 573
-160.06173412 53
-160.06724249 53
-160.06757386 53
-160.13012197 53
-160.22663631 0
-160.27215602 1343
-160.31640494 601
-160.32365430 0
-160.46328395 0
-160.60115572 601
-160.74482889 1343
-160.75859508 601
-160.77740494 1343
-160.95870970 573
-161.08814792 53
-161.51186035 53
-161.57852856 573
-161.67113743 601
-161.70399720 53
-161.89382155 835
-161.94492771 53
-162.03366584 989
-162.19912069 835
-162.25622780 1343
-162.61064151 989
-162.82813995 601
-163.04308966 1343
-163.46119769 989
-163.46241144 53
-163.46367103 835
-163.67580293 1343
-163.85549505 601
-163.92183750 989
-164.20949883 601
-164.28189004 601
-164.32741917 1343
-164.40186283 989
-164.44801748 0
-164.64528253 1343
-164.64549344 989
-164.77758012 53
-164.83485138 573
-164.86204474 53
-165.01472283 601
-165.13202177 1343
-165.18391020 601
-165.44860714 0
-165.59276248 1343
-165.62835073 573
-165.62865567 989
-165.78721586 573
-165.86870215 989
-165.99328568 835
-166.00442792 835
-166.17633957 1343
-166.21623890 0
-166.40871840 835
-166.46863692 989
-166.47616965 601
-166.52358845 53
-166.78799875 573
-166.85965428 835
-166.94716417 601
-167.18260506 0
-167.52956238 0
-167.89903515 835
-168.10107984 0
-168.22561724 1343
-168.38809584 989
-168.39832638 601
-168.40564959 1343
-168.47604397 0
-168.49746751 573
-168.95834482 0
-169.22575532 573
-169.34100331 1343
-169.87108203 0
-169.88831891 1343
-170.21254961 601
-170.24896174 573
-170.25277153 835
-170.32181845 989
-170.38209367 601
-170.72800294 53
-170.96158527 1343
-170.98203576 53
-171.28616710 989
-171.47387123 1343
-171.63546542 835
-172.10228816 53
-172.14955573 573
-172.20661901 989
-172.25459914 1343
-172.38503961 53
-172.48590420 989
-172.68112056 573
-172.77275118 835
-172.81083426 835
-172.83126614 573
-172.94340035 573
-173.02964887 53
-173.22461014 573
-173.35252750 1343
-173.36691435 835
-173.56957992 601
-173.65382539 573
-173.95253259 989
-173.99073366 53
-174.31217517 1343
-174.32141397 0
-174.39753187 601
-174.41582555 53
-174.47022349 601
-174.51276600 1343
-174.53072608 573
-174.66053551 0
-174.85943479 835
-175.23706747 601
-175.30513924 989
-175.40320918 835
-175.43221109 573
-175.44486906 0
-175.55693797 1343
-175.76987013 989
-175.77135670 989
-175.83436921 1343
-175.86429096 0
-175.87914230 989
-175.91447424 989
-176.06408589 0
-176.07658158 989
-176.30010152 0
-176.54704026 573
-176.75251967 53
-176.77847229 53
-176.80374513 989
-176.96393820 573
-177.07810425 1343
-177.42478803 573
-177.68771595 989
-177.74560367 0
-177.95415324 989
-177.99182064 835
-178.03441476 601
-178.05886850 1343
-178.21558517 573
-178.49232908 1343
-178.85630771 53
-179.25051220 573
-179.30000937 989
-179.41383105 573
-179.43884101 835
-179.51405065 601
-179.52822321 573
-179.60179511 0
-179.60908987 835
-179.76571758 835
-180.00430463 835
-180.05974969 989
-180.30291401 601
-180.36652599 835
-180.64930652 601
-180.80889774 989
-180.84399570 0
-180.85695931 53
-180.87678503 53
-180.92841427 601
-181.10747815 835
-181.23920225 601
-181.42374670 601
-181.44361080 573
-181.53585174 573
-181.63706930 835
-181.73762562 1343
-181.78599529 835
-181.96252817 53
-181.97048608 601
-181.99440914 0
-182.11892467 1343
-182.22225275 1343
-182.23493099 53
-182.37572997 989
-182.42344710 0
-182.59639509 989
-182.64300249 53
-182.75643761 53
-182.86340756 1343
-182.91232948 0
-182.95663867 573
-183.01003520 989
-183.04662569 573
-183.05126770 53
-183.14657434 601
-183.18016555 0
-183.31932645 0
-183.39991355 601
-183.71263941 989
-183.77925423 601
-183.79305543 989
-184.06224377 1343
-184.38705325 601
-184.50857875 989
-184.84867502 1343
-184.87884395 835
-184.88029509 835
-184.93593001 573
-184.98317793 573
-185.23987434 573
-185.39269058 601
-185.54572645 601
-185.55286346 0
-185.65423439 835
-185.65629142 573
-186.05365045 53
-186.11877434 989
-186.19618287 0
-186.33712567 53
-186.35802569 989
-186.48686839 989
-186.56696957 601
-186.68428363 835
-186.69710376 53
-186.76364515 1343
-186.90305009 0
-186.90677631 0
-187.28520256 573
-187.49312807 601
-187.50225590 989
-187.55436598 0
-187.57517902 53
-187.68804940 989
-187.70770091 835
-187.72310682 601
-187.86177432 53
-188.65482110 601
-188.71948374 573
-188.74849195 1343
-188.77797278 573
-188.79799746 0
-188.85525209 601
-188.88002662 1343
-188.89969469 989
-188.95150410 53
-188.96618995 835
-189.13141017 573
-189.22886732 601
-189.39791033 0
-189.90041842 0
-189.92431662 53
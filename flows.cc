@@ -0,0 +1,47 @@
+#include <iostream>
+#include "src/Timeseries.hh"
+#include "src/TimeParse.hh"
+#include "src/Solver.hh"
+#include "src/Flow.hh"
+
+int main(int argc, char *argv[])
+{
+	if(argc < 3 || argc > 7)
+	{
+		fprintf(stderr, "Usage: %s <capture_csv> <pdcp_log> [ue_address] "
+				"[capture_utc_offset_hours] [pdcp_utc_offset_hours] [threads]\n", argv[0]);
+		return -1;
+	}
+	std::string ue = argc > 3 ? argv[3] : "";
+	double capture_offset = argc > 4 ? std::stod(argv[4]) : 0;
+	double lte_offset = argc > 5 ? std::stod(argv[5]) : 0;
+	unsigned threads = argc > 6 ? std::stoul(argv[6]) : 0;
+
+	/* the capture's _ws.col.Time is the local date and time of the capture host */
+	src::ReadStats flow_stats, large_stats;
+	src::TimestampParser capture_parser(src::TimestampParser::Format::DATE_TIME, "1970-01-01",
+			capture_offset);
+	auto flows = src::FlowReader::ReadFlows(argv[1], src::FlowColumns(), ',', 
+			src::ReadMode::SKIP, &flow_stats, &capture_parser);
+	src::TimestampParser lte_parser(src::TimestampParser::Format::AUTO, "1970-01-01", lte_offset);
+	auto large = src::TimeseriesReader::ReadPdcpLog(argv[2], src::ReadMode::SKIP, &large_stats, &lte_parser);
+	std::cerr<<argv[1]<<": "<<flow_stats.to_string()<<", "<<flows.size()<<" flows"<<std::endl;
+	std::cerr<<argv[2]<<": "<<large_stats.to_string()<<std::endl;
+
+	/* without the ue address the directions are unknown, match them all */
+	if(ue.empty()) large.setDirection(src::Direction::ANY);
+	else src::FlowReader::tagDirections(flows, ue);
+
+	src::FlowAligner aligner([]{ return std::unique_ptr<src::SolverBase>(new src::MinEpsilon(0.5)); },
+			threads);
+	auto results = aligner.align(flows, large);
+
+	/* the solver messages go to stderr, in flow order */
+	for(auto &fr : results) std::cerr<<fr.key.to_string()<<":"<<std::endl<<fr.log;
+	std::cout<<"consensus offset: "<<src::FlowAligner::consensus(results)<<std::endl;
+	for(auto &fr : results)
+	{
+		std::cout<<fr.key.to_string()<<" points="<<fr.points
+			<<(fr.consistent ? "" : " INCONSISTENT")<<" "<<fr.result.to_json()<<std::endl;
+	}
+}
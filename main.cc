@@ -1,22 +1,256 @@
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <memory>
+#include <cstdio>
 #include "src/Timeseries.hh"
+#include "src/TimeParse.hh"
 #include "src/Solver.hh"
+#include "src/Refine.hh"
+#include "src/Sketch.hh"
+
+/* how one input file is read */
+struct Input
+{
+    std::string format{"two"};      // two: time value, pdcp: '$' separated PDCP log
+    int tcol = -1, vcol = -1;       // read these columns instead of the first two
+    char delim = ' ';
+    std::string time{"auto"};       // auto, epoch, time, datetime
+    std::string base_date{"1970-01-01"};
+    double utc_offset = 0;
+    std::string direction{"any"};   // any, uplink, downlink
+};
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "Usage: %s [options] <small_file> <large_file> [<small_file> <large_file> ...]\n"
+            "  --solver BruteForce|MinEpsilon  (default BruteForce)\n"
+            "  --eps E           largest accepted epsilon, seconds (default 0.5)\n"
+            "  --range R         search |delta_t| < R seconds (default 200)\n"
+            "  --threads N       threads reading each input, 0 uses all (default 1);\n"
+            "                    the solvers always run on one thread\n"
+            "  --no-sketch       do not prefilter BruteForce candidates\n"
+            "  --no-refine       skip the offset refinement\n"
+            "  --output json|csv (default json), --no-header omits the csv header\n"
+            "  --quiet           drop the progress messages on stderr\n"
+            " input options, for both files or prefixed by --small- / --large-:\n"
+            "  --format two|pdcp, --cols T,V, --delim C, --time auto|epoch|time|datetime\n"
+            "  --base-date YYYY-MM-DD, --utc-offset H\n"
+            "  --direction any|uplink|downlink  tag the points (pdcp: keep those records)\n"
+            " results go to stdout, one line per pair, diagnostics to stderr\n", name);
+}
+
+/* set an input option, false if key is not one */
+static bool parse_input(Input &in, const std::string &key, const std::string &val)
+{
+    if(key == "format") in.format = val;
+    else if(key == "cols")
+    {
+        auto comma = val.find(',');
+        if(comma == std::string::npos) throw std::invalid_argument("--cols needs T,V");
+        in.tcol = std::stoi(val.substr(0, comma));
+        in.vcol = std::stoi(val.substr(comma + 1));
+    }
+    else if(key == "delim") in.delim = val == "\\t" ? '\t' : val.at(0);
+    else if(key == "time") in.time = val;
+    else if(key == "base-date") in.base_date = val;
+    else if(key == "utc-offset") in.utc_offset = std::stod(val);
+    else if(key == "direction") in.direction = val;
+    else return false;
+    return true;
+}
+
+static src::Direction parse_direction(const std::string &name)
+{
+    if(name == "any") return src::Direction::ANY;
+    if(name == "uplink") return src::Direction::UPLINK;
+    if(name == "downlink") return src::Direction::DOWNLINK;
+    throw std::invalid_argument("unknown direction " + name);
+}
+
+static src::Timeseries read_input(const std::string &fname, const Input &in,
+        unsigned threads, src::ReadStats &stats)
+{
+    using src::TimeseriesReader;
+    using src::ReadMode;
+    src::TimestampParser parser(src::TimestampParser::parseFormat(in.time),
+            in.base_date, in.utc_offset);
+    auto dir = parse_direction(in.direction);
+    if(in.format == "pdcp")
+    {
+        auto ret = TimeseriesReader::ReadPdcpLog(fname, ReadMode::SKIP, &stats, &parser);
+        if(dir == src::Direction::ANY) return std::move(ret.setDirection(dir));
+        return ret.select(dir);
+    }
+    if(in.format != "two") throw std::invalid_argument("unknown format " + in.format);
+    auto read = [&]()
+    {
+        if(in.tcol >= 0)
+            return TimeseriesReader::ReadByColId(fname, in.tcol, in.vcol, in.delim, 
+                    ReadMode::SKIP, &stats, &parser);
+        if(threads != 1)
+            return TimeseriesReader::ReadTwoColsParallel(fname, in.delim, threads, 
+                    ReadMode::SKIP, &stats, &parser);
+        return TimeseriesReader::ReadTwoCols(fname, in.delim, ReadMode::SKIP, &stats, &parser);
+    };
+    auto ret = read();
+    return std::move(ret.setDirection(dir));
+}
+
+/* a csv field, quoted when it holds a delimiter, a quote or a line break */
+static std::string csv_field(const std::string &str)
+{
+    if(str.find_first_of(",\"\r\n") == std::string::npos) return str;
+    std::string ret{"\""};
+    for(char c : str)
+    {
+        if(c == '"') ret += '"';
+        ret += c;
+    }
+    return ret + "\"";
+}
 
 int main(int argc, char *argv[])
 {
-	if(argc != 3)
-	{
-		fprintf(stderr, "Usage: %s <small_tcp_file> <large_lte_file>\n", argv[0]);
-		return -1;
-	}
-    src::TimeseriesReader reader;
-	std::cout<<"Reading two files..."<<std::endl;
-    auto small{reader.ReadTwoCols(argv[1])};
-    auto large{reader.ReadTwoCols(argv[2])};
-	std::cout<<"Done!"<<std::endl;
-
-	std::cout<<"Solve the problem..."<<std::endl;
-	src::BruteForce solver(0.5);
-	auto delta = solver.solve(small, large);
-	std::cout<<"Done! The result is: "<<delta<<std::endl;
+    Input small_in, large_in;
+    std::string solver_name{"BruteForce"}, output{"json"};
+    double eps = 0.5, range = 200;
+    unsigned threads = 1;
+    bool use_sketch = true, refine = true, header = true, quiet = false;
+    std::vector<std::string> files;
+    try
+    {
+        for(int i = 1; i < argc; i++)
+        {
+            std::string arg{argv[i]};
+            if(arg.compare(0, 2, "--") != 0) { files.push_back(arg); continue; }
+            std::string key = arg.substr(2);
+            if(key == "no-sketch") { use_sketch = false; continue; }
+            if(key == "no-refine") { refine = false; continue; }
+            if(key == "no-header") { header = false; continue; }
+            if(key == "quiet") { quiet = true; continue; }
+            if(key == "help") { usage(argv[0]); return 0; }
+            if(i + 1 >= argc) { usage(argv[0]); return 2; }
+            std::string val{argv[++i]};
+            if(key == "solver") solver_name = val;
+            else if(key == "eps") eps = std::stod(val);
+            else if(key == "range") range = std::stod(val);
+            else if(key == "threads") threads = std::stoul(val);
+            else if(key == "output") output = val;
+            else if(key.compare(0, 6, "small-") == 0 && parse_input(small_in, key.substr(6), val)) {}
+            else if(key.compare(0, 6, "large-") == 0 && parse_input(large_in, key.substr(6), val)) {}
+            else if(parse_input(small_in, key, val)) parse_input(large_in, key, val);
+            else { usage(argv[0]); return 2; }
+        }
+        src::TimestampParser::parseFormat(small_in.time);
+        src::TimestampParser::parseFormat(large_in.time);
+        parse_direction(small_in.direction);
+        parse_direction(large_in.direction);
+    }catch(std::exception &e)
+    {
+        fprintf(stderr, "%s: %s\n", argv[0], e.what());
+        usage(argv[0]);
+        return 2;
+    }
+    if(files.empty() || files.size() % 2 || (solver_name != "BruteForce" && solver_name != "MinEpsilon")
+            || (output != "json" && output != "csv"))
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    /* stdout only carries the results, the progress goes to stderr unless quiet */
+    std::ofstream devnull("/dev/null");
+    std::ostream &log = quiet ? devnull : std::cerr;
+    std::cout<<std::setprecision(12);
+
+    if(output == "csv" && header)
+    {
+        std::cout<<"small,large,solver,offset,epsilon,matched_ratio,candidates,probes,"
+            "refined_offset,ci_low,ci_high,matches,load,generation,verification"<<std::endl;
+    }
+    int status = 0;
+    for(size_t i = 0; i < files.size(); i += 2)
+    {
+        const auto &small_f = files[i], &large_f = files[i + 1];
+        try
+        {
+            src::Stopwatch watch;
+            src::ReadStats small_stats, large_stats;
+            auto small = read_input(small_f, small_in, threads, small_stats);
+            auto large = read_input(large_f, large_in, threads, large_stats);
+            std::unique_ptr<src::ValueTimeSketch> sketch;
+            std::unique_ptr<src::SolverBase> solver;
+            if(solver_name == "MinEpsilon") solver.reset(new src::MinEpsilon(eps));
+            else
+            {
+                solver.reset(new src::BruteForce(eps));
+                if(use_sketch)
+                {
+                    sketch.reset(new src::ValueTimeSketch(large));
+                    solver->setSketch(sketch.get());
+                }
+            }
+            solver->setRange(range);
+            solver->setLog(log);
+            auto load = watch.elapsed();
+            log<<small_f<<": "<<small_stats.to_string()<<std::endl;
+            log<<large_f<<": "<<large_stats.to_string()<<std::endl;
+            if(small.size() == 0 || large.size() == 0)
+                throw std::runtime_error("no points read");
+
+            auto result = solver->solve(small, large);
+            result.load = load;
+            src::Estimate est;
+            if(refine && result.found())
+                est = src::Refiner().refine(small, large, result.offset, result.epsilon);
+            if(!result.found()) status = 1;
+
+            if(output == "json")
+            {
+                std::cout<<"{\"small\":";
+                src::json_string(std::cout, small_f);
+                std::cout<<",\"large\":";
+                src::json_string(std::cout, large_f);
+                std::cout<<",\"result\":"<<result.to_json()<<",\"refined\":";
+                if(refine && result.found())
+                {
+                    std::cout<<"{\"offset\":";
+                    src::json_number(std::cout, est.offset);
+                    std::cout<<",\"ci_low\":";
+                    src::json_number(std::cout, est.ci_low);
+                    std::cout<<",\"ci_high\":";
+                    src::json_number(std::cout, est.ci_high);
+                    std::cout<<",\"trimmed_mean\":";
+                    src::json_number(std::cout, est.trimmed_mean);
+                    std::cout<<",\"matches\":"<<est.matches<<"}";
+                }
+                else std::cout<<"null";
+                std::cout<<"}"<<std::endl;
+            }
+            else
+            {
+                /* empty field when not finite, as null in json */
+                auto num = [](double v)
+                {
+                    std::ostringstream o;
+                    o<<std::setprecision(12);
+                    if(std::isfinite(v)) o<<v;
+                    return o.str();
+                };
+                std::cout<<csv_field(small_f)<<","<<csv_field(large_f)<<","<<result.solver<<","<<num(result.offset)
+                    <<","<<num(result.epsilon)<<","<<num(result.matched_ratio)
+                    <<","<<result.generated<<","<<result.probes
+                    <<","<<num(est.offset)<<","<<num(est.ci_low)<<","<<num(est.ci_high)
+                    <<","<<est.matches<<","<<result.load.wall<<","<<result.generation.wall
+                    <<","<<result.verification.wall<<std::endl;
+            }
+        }catch(std::exception &e)
+        {
+            std::cerr<<argv[0]<<": "<<small_f<<" "<<large_f<<": "<<e.what()<<std::endl;
+            status = 1;
+        }
+    }
+    return status;
 }
@@ -0,0 +1,199 @@
+#include <fstream>
+#include <algorithm>
+#include <stdexcept>
+#include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <cstdio>
+#include <vector>
+#include <zstd.h>
+#endif
+#include "Compress.hh"
+
+namespace src
+{
+
+/* ====================== PipelineBuf ======================== */
+PipelineBuf::PipelineBuf(Producer_t producer, size_t block, size_t depth)
+    : producer_(std::move(producer)), block_(block), depth_(std::max<size_t>(depth, 1))
+{
+    setg(nullptr, nullptr, nullptr);
+    worker_ = std::thread(&PipelineBuf::produce, this);
+}
+
+PipelineBuf::~PipelineBuf()
+{
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        closed_ = true;
+    }
+    cv_.notify_all();
+    worker_.join();
+}
+
+void PipelineBuf::produce()
+{
+    try
+    {
+        while(true)
+        {
+            std::string buf(block_, '\0');
+            size_t n = producer_(&buf[0], buf.size());
+            if(n == 0) break;
+            buf.resize(n);
+            std::unique_lock<std::mutex> lock(mtx_);
+            cv_.wait(lock, [this]{ return closed_ || queue_.size() < depth_; });
+            if(closed_) return;
+            queue_.push_back(std::move(buf));
+            lock.unlock();
+            cv_.notify_all();
+        }
+    }catch(...)
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        error_ = std::current_exception();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        done_ = true;
+    }
+    cv_.notify_all();
+}
+
+PipelineBuf::int_type PipelineBuf::underflow()
+{
+    if(gptr() < egptr()) return traits_type::to_int_type(*gptr());
+    std::unique_lock<std::mutex> lock(mtx_);
+    cv_.wait(lock, [this]{ return done_ || !queue_.empty(); });
+    if(queue_.empty())
+    {
+        if(error_) std::rethrow_exception(error_);
+        return traits_type::eof();
+    }
+    current_ = std::move(queue_.front());
+    queue_.pop_front();
+    lock.unlock();
+    cv_.notify_all();
+    setg(&current_[0], &current_[0], &current_[0] + current_.size());
+    return traits_type::to_int_type(*gptr());
+}
+
+/* ====================== open_input ======================== */
+Compression detect_compression(const std::string &fname)
+{
+    std::ifstream fin(fname, std::ios::binary);
+    if(!fin) throw std::runtime_error("file not found!\n");
+    unsigned char magic[4] = {0, 0, 0, 0};
+    fin.read(reinterpret_cast<char *>(magic), 4);
+    if(fin.gcount() >= 2 && magic[0] == 0x1f && magic[1] == 0x8b)
+        return Compression::GZIP;
+    if(fin.gcount() == 4 && magic[0] == 0x28 && magic[1] == 0xb5
+            && magic[2] == 0x2f && magic[3] == 0xfd)
+        return Compression::ZSTD;
+    return Compression::NONE;
+}
+
+/* istream owning its PipelineBuf */
+class PipelineStream : public std::istream
+{
+    private:
+        std::unique_ptr<PipelineBuf> buf_;
+    public:
+        PipelineStream(std::unique_ptr<PipelineBuf> buf)
+            : std::istream(buf.get()), buf_(std::move(buf))
+        {
+            exceptions(std::ios::badbit);   // rethrow decompression errors
+        }
+        virtual ~PipelineStream() { exceptions(std::ios::goodbit); rdbuf(nullptr); }
+};
+
+static PipelineBuf::Producer_t gzip_producer(const std::string &fname)
+{
+    std::shared_ptr<gzFile_s> gz(gzopen(fname.c_str(), "rb"),
+            [](gzFile f){ if(f) gzclose(f); });
+    if(!gz) throw std::runtime_error("open_input: cannot open gzip file " + fname);
+    gzbuffer(gz.get(), 1 << 18);
+    return [gz, fname](char *buf, size_t len) -> size_t
+    {
+        int n = gzread(gz.get(), buf, static_cast<unsigned>(len));
+        int err = Z_OK;
+        const char *msg = gzerror(gz.get(), &err);
+        /* a truncated archive reads short with Z_BUF_ERROR set */
+        if(n < 0 || (err != Z_OK && err != Z_STREAM_END))
+            throw std::runtime_error("open_input: gzip error in " + fname + ": " + msg);
+        return n;
+    };
+}
+
+#ifdef HAVE_ZSTD
+static PipelineBuf::Producer_t zstd_producer(const std::string &fname)
+{
+    struct State
+    {
+        FILE *fin = nullptr;
+        ZSTD_DStream *ds = nullptr;
+        std::vector<char> in;
+        ZSTD_inBuffer input{nullptr, 0, 0};
+        size_t last = 0;    // last ZSTD_decompressStream result, 0 at a frame end
+        ~State() { if(fin) fclose(fin); if(ds) ZSTD_freeDStream(ds); }
+    };
+    auto st = std::make_shared<State>();
+    st->fin = fopen(fname.c_str(), "rb");
+    st->ds = ZSTD_createDStream();
+    if(!st->fin || !st->ds) throw std::runtime_error("open_input: cannot open zstd file " + fname);
+    ZSTD_initDStream(st->ds);
+    st->in.resize(ZSTD_DStreamInSize());
+    return [st, fname](char *buf, size_t len) -> size_t
+    {
+        ZSTD_outBuffer output{buf, len, 0};
+        while(output.pos == 0)
+        {
+            bool eof = false;
+            if(st->input.pos == st->input.size)
+            {
+                size_t n = fread(st->in.data(), 1, st->in.size(), st->fin);
+                if(n == 0 && ferror(st->fin))
+                    throw std::runtime_error("open_input: zstd error in " + fname + ": read error");
+                if(n == 0) eof = true;
+                else st->input = ZSTD_inBuffer{st->in.data(), n, 0};
+            }
+            if(eof && st->last == 0) break;
+            size_t ret = ZSTD_decompressStream(st->ds, &output, &st->input);
+            if(ZSTD_isError(ret))
+                throw std::runtime_error("open_input: zstd error in " + fname + ": "
+                        + ZSTD_getErrorName(ret));
+            st->last = ret;
+            /* a truncated frame: the decoder has flushed and still wants input */
+            if(eof && output.pos == 0)
+                throw std::runtime_error("open_input: zstd error in " + fname
+                        + ": unexpected end of file");
+        }
+        return output.pos;
+    };
+}
+#endif
+
+std::unique_ptr<std::istream> open_input(const std::string &fname)
+{
+    switch(detect_compression(fname))
+    {
+        case Compression::GZIP:
+            return std::unique_ptr<std::istream>(new PipelineStream(
+                        std::unique_ptr<PipelineBuf>(new PipelineBuf(gzip_producer(fname)))));
+        case Compression::ZSTD:
+#ifdef HAVE_ZSTD
+            return std::unique_ptr<std::istream>(new PipelineStream(
+                        std::unique_ptr<PipelineBuf>(new PipelineBuf(zstd_producer(fname)))));
+#else
+            throw std::runtime_error("open_input: " + fname + " is zstd compressed, "
+                    "rebuild with ZSTD=1 to read it");
+#endif
+        case Compression::NONE:
+        default:
+            break;
+    }
+    std::unique_ptr<std::istream> ret(new std::ifstream(fname));
+    if(!*ret) throw std::runtime_error("file not found!\n");
+    return ret;
+}
+
+} // namespace src
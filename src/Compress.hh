@@ -0,0 +1,68 @@
+#ifndef _COMPRESS_HH_
+#define _COMPRESS_HH_
+#include <string>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <istream>
+#include <functional>
+#include <exception>
+#include <condition_variable>
+
+namespace src
+{
+
+enum class Compression { NONE, GZIP, ZSTD };
+class PipelineBuf;
+
+/**
+ * function detect_compression
+ * detect the compression of a file by its magic bytes
+ */
+Compression detect_compression(const std::string &fname);
+
+/**
+ * function open_input
+ * open a file for reading. gzip (and zstd when built with ZSTD=1) files
+ * are decompressed on a background thread while the caller parses the
+ * returned stream, so no temporary file is needed
+ */
+std::unique_ptr<std::istream> open_input(const std::string &fname);
+
+/**
+ * class PipelineBuf
+ * stream buffer fed by a producer running on its own thread. The producer
+ * fills blocks (returning the bytes written, 0 at the end), at most depth
+ * blocks are queued ahead of the reader
+ */
+class PipelineBuf : public std::streambuf
+{
+    public:
+        using Producer_t = std::function<size_t(char *, size_t)>;
+    private:
+        Producer_t producer_;
+        size_t block_;
+        size_t depth_;
+
+        std::mutex mtx_;
+        std::condition_variable cv_;
+        std::deque<std::string> queue_;
+        bool done_   = false;   // producer reached the end
+        bool closed_ = false;   // reader is gone, producer should stop
+        std::exception_ptr error_;
+
+        std::string current_;   // block being read
+        std::thread worker_;
+
+        void produce();
+    protected:
+        virtual int_type underflow() override;
+    public:
+        PipelineBuf(Producer_t producer, size_t block = 1 << 18, size_t depth = 4);
+        virtual ~PipelineBuf();
+};
+
+} // namespace src
+
+#endif
@@ -0,0 +1,133 @@
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <sstream>
+#include "Flow.hh"
+#include "TimeParse.hh"
+
+namespace src
+{
+
+FlowReader::FlowMap_t FlowReader::ReadFlows(const std::string &fname, const FlowColumns &cols,
+        const char delim, ReadMode mode, ReadStats *stats, const TimestampParser *parser)
+{
+    INSTRUMENT_SCOPE("FlowReader::ReadFlows");
+    static const TimestampParser default_parser(TimestampParser::Format::DATE_TIME);
+    if(!parser) parser = &default_parser;
+    FlowMap_t ret;
+    src::input_helper helper(fname, delim, true);
+    const int maxcol = std::max({cols.time, cols.src, cols.dst, cols.sport, 
+            cols.dport, cols.value, cols.header, cols.proto});
+    auto parse_size = [](const std::string &str, long long &size)
+    {
+        char *end = nullptr;
+        size = std::strtoll(str.c_str(), &end, 10);
+        return end != str.c_str() && size >= 0;
+    };
+    while(helper.hasNext())
+    {
+        auto vec = helper.next();
+        if(vec.size() == 0) continue;
+        Timestamp time;
+        long long value = 0, header = 0;
+        bool ok = (int)vec.size() > maxcol && parser->parse(vec[cols.time], time)
+            && parse_size(vec[cols.value], value)
+            && (cols.header < 0 || parse_size(vec[cols.header], header));
+        if(ok)
+        {
+            value += header + cols.overhead;
+            ok = value >= 0 && (unsigned long long)value <= Timeseries::MAX_VALUE;
+        }
+        if(!ok)
+        {
+            helper.malformed(mode, "FlowReader::ReadFlows");
+            continue;
+        }
+        if(cols.excluded.count(value)) continue;
+        FlowKey key{vec[cols.src], vec[cols.dst], vec[cols.sport], vec[cols.dport],
+            cols.proto < 0 ? "tcp" : vec[cols.proto]};
+        ret[key].insert(time, value);
+    }
+    if(stats) *stats = helper.stats();
+    return ret;
+}
+
+void FlowReader::tagDirections(FlowMap_t &flows, const std::string &ue)
+{
+    for(auto &ent : flows) ent.second.setDirection(ent.first.direction(ue));
+}
+
+FlowAligner::FlowAligner(Factory_t factory, unsigned threads, size_t min_points,
+        double tolerance)
+    : factory_(std::move(factory)), threads_(threads), min_points_(min_points), 
+    tolerance_(tolerance)
+{
+    if(threads_ == 0) threads_ = std::max(1u, std::thread::hardware_concurrency());
+}
+
+std::vector<FlowResult> FlowAligner::align(const FlowReader::FlowMap_t &flows,
+        const TimeseriesView &large) const
+{
+    std::vector<FlowResult> ret;
+    std::vector<const Timeseries *> series;
+    for(auto &ent : flows)
+    {
+        if(ent.second.getData().size() < min_points_) continue;
+        FlowResult fr;
+        fr.key = ent.first;
+        fr.points = ent.second.getData().size();
+        ret.push_back(fr);
+        series.push_back(&ent.second);
+    }
+
+    /* the workers take the next flow until none is left */
+    std::atomic<size_t> next{0};
+    std::vector<std::exception_ptr> errors(threads_);
+    auto work = [&](unsigned id)
+    {
+        try
+        {
+            for(size_t i = next++; i < ret.size(); i = next++)
+            {
+                INSTRUMENT_SCOPE("FlowAligner::solve");
+                std::ostringstream log;
+                auto solver = factory_();
+                solver->setLog(log);
+                try
+                {
+                    ret[i].result = solver->solve(*series[i], large);
+                }catch(std::invalid_argument &e)
+                {
+                    log<<"FlowAligner::align: "<<e.what()<<std::endl;
+                }
+                ret[i].log = log.str();
+            }
+        }catch(...)
+        {
+            errors[id] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> workers;
+    for(unsigned i = 0; i < std::min<size_t>(threads_, ret.size()); i++)
+        workers.emplace_back(work, i);
+    for(auto &w : workers) w.join();
+    for(auto &e : errors) if(e) std::rethrow_exception(e);
+
+    auto median = consensus(ret);
+    for(auto &fr : ret)
+        fr.consistent = fr.result.found() && std::fabs(fr.result.offset - median) <= tolerance_;
+    return ret;
+}
+
+double FlowAligner::consensus(const std::vector<FlowResult> &results)
+{
+    std::vector<double> offsets;
+    for(auto &fr : results)
+        if(fr.result.found()) offsets.push_back(fr.result.offset);
+    if(offsets.empty()) return NAN;
+    std::sort(offsets.begin(), offsets.end());
+    auto n = offsets.size();
+    return n % 2 ? offsets[n / 2] : (offsets[n / 2 - 1] + offsets[n / 2]) / 2.;
+}
+
+} // namespace src
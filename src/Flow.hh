@@ -0,0 +1,149 @@
+#ifndef _FLOW_HH_
+#define _FLOW_HH_
+#include <map>
+#include <set>
+#include <memory>
+#include <string>
+#include <vector>
+#include <functional>
+#include <tuple>
+#include "Timeseries.hh"
+#include "Solver.hh"
+
+namespace src
+{
+
+struct FlowKey;
+struct FlowColumns;
+struct FlowResult;
+class FlowReader;
+class FlowAligner;
+
+/**
+ * struct FlowKey
+ * the 5-tuple of a (directional) flow
+ */
+struct FlowKey
+{
+    std::string src, dst;
+    std::string sport, dport;
+    std::string proto;
+
+    bool operator<(const FlowKey &r) const
+    {
+        return std::tie(src, dst, sport, dport, proto) 
+            < std::tie(r.src, r.dst, r.sport, r.dport, r.proto);
+    }
+    /* direction seen from the ue, ANY if the ue is neither end */
+    Direction direction(const std::string &ue) const
+    {
+        return src == ue ? Direction::UPLINK : dst == ue ? Direction::DOWNLINK : Direction::ANY;
+    }
+    std::string to_string() const
+    {
+        return proto + " " + src + ":" + sport + " > " + dst + ":" + dport;
+    }
+};
+
+/**
+ * struct FlowColumns
+ * column ids of a capture export, the defaults match the tshark csv
+ * export of data/real/1c.csv. proto = -1 uses "tcp" for every packet.
+ * The value of a packet is its PDCP PDU size as in data/real/filter_pdcp.sh,
+ * value + header (-1 for none) + overhead, packets of an excluded size
+ * (the pure acks and the segments the PDCP log does not show) are dropped
+ */
+struct FlowColumns
+{
+    int time    = 1;    // _ws.col.Time, local date and time in nanoseconds
+    int src     = 3;
+    int dst     = 4;
+    int sport   = 6;
+    int dport   = 7;
+    int value   = 16;   // tcp.len
+    int header  = 17;   // tcp.hdr_len
+    int proto   = -1;
+    long long overhead = 22;   // IP header without options
+    std::set<long long> excluded{54, 66, 74, 1412};
+};
+
+/**
+ * class FlowReader
+ * read a capture export and demultiplex its packets by flow in one scan
+ */
+class FlowReader
+{
+    public:
+        using FlowMap_t = std::map<FlowKey, Timeseries>;
+
+        /**
+         * static method: ReadFlows
+         * one Timeseries per flow, empty csv fields are kept in place.
+         * Rows without a valid time or value (e.g. the header) are 
+         * malformed, skipped by default. Rows of an excluded size are
+         * dropped without counting. Times are DATE_TIME in UTC unless
+         * a parser is given, e.g. with the UTC offset of the capture
+         */
+        static FlowMap_t ReadFlows(const std::string &, const FlowColumns &cols = FlowColumns(),
+                const char delim = ',', ReadMode mode = ReadMode::SKIP,
+                ReadStats *stats = nullptr, const TimestampParser *parser = nullptr);
+
+        /**
+         * static method: tagDirections
+         * tag every flow with its direction seen from the ue address,
+         * so that it only matches PDCP records of the same direction
+         */
+        static void tagDirections(FlowMap_t &flows, const std::string &ue);
+};
+
+/**
+ * struct FlowResult
+ * the alignment of one flow
+ */
+struct FlowResult
+{
+    FlowKey key;
+    size_t points = 0;
+    SolveResult result;
+    bool consistent = false;    // offset agrees with the consensus
+    std::string log;            // messages of its solver, or why it failed
+};
+
+/**
+ * class FlowAligner
+ * align every flow of a capture against the same large series on a pool
+ * of threads (one solver per flow from the factory), then cross-check the
+ * offsets against their median. The solvers log into their FlowResult,
+ * a flow its solver rejects (e.g. no direction in common with the large
+ * series) is left without solution
+ */
+class FlowAligner
+{
+    public:
+        using Factory_t = std::function<std::unique_ptr<SolverBase>()>;
+    private:
+        Factory_t factory_;
+        unsigned threads_;
+        size_t min_points_;     // smaller flows are not aligned
+        double tolerance_;      // max distance to the consensus, seconds
+    public:
+        FlowAligner(Factory_t factory, unsigned threads = 0, size_t min_points = 16,
+                double tolerance = 1e-2);
+
+        /**
+         * method align
+         * results in flow order, only for flows with min_points or more
+         */
+        std::vector<FlowResult> align(const FlowReader::FlowMap_t &flows, 
+                const TimeseriesView &large) const;
+
+        /**
+         * static method: consensus
+         * median offset of the flows with a solution, NAN if none
+         */
+        static double consensus(const std::vector<FlowResult> &results);
+};
+
+} // namespace src
+
+#endif
@@ -0,0 +1,183 @@
+#include <map>
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include "Instrument.hh"
+
+namespace src
+{
+
+namespace
+{
+
+/* one frame of the scope stack of a thread */
+struct Frame
+{
+    std::string path;       // outer;...;this
+    uint64_t children = 0;  // nanoseconds spent in nested scopes
+};
+
+struct ThreadData;
+
+/**
+ * the probe names and the totals of the finished threads. A name is never
+ * changed once its id is handed out, so it is read without the lock
+ */
+struct Registry
+{
+    std::mutex mtx;
+    std::array<std::string, Instrument::MAX_PROBES> names;
+    size_t size = 0;
+    std::vector<ThreadData *> live;
+    std::array<uint64_t, Instrument::MAX_PROBES> count{}, nanos{};
+    std::map<std::string, uint64_t> folded;
+
+    ~Registry();
+};
+
+Registry &registry()
+{
+    static Registry r;
+    return r;
+}
+
+/* counters of one thread, only written by it */
+struct ThreadData
+{
+    std::array<std::atomic<uint64_t>, Instrument::MAX_PROBES> count, nanos;
+    std::vector<Frame> stack;
+    std::map<std::string, uint64_t> folded;
+
+    ThreadData()
+    {
+        for(auto &c : count) c.store(0, std::memory_order_relaxed);
+        for(auto &c : nanos) c.store(0, std::memory_order_relaxed);
+        auto &r = registry();
+        std::lock_guard<std::mutex> lock(r.mtx);
+        r.live.push_back(this);
+    }
+
+    ~ThreadData()
+    {
+        auto &r = registry();
+        std::lock_guard<std::mutex> lock(r.mtx);
+        for(size_t i = 0; i < Instrument::MAX_PROBES; i++)
+        {
+            r.count[i] += count[i].load(std::memory_order_relaxed);
+            r.nanos[i] += nanos[i].load(std::memory_order_relaxed);
+        }
+        for(auto &ent : folded) r.folded[ent.first] += ent.second;
+        for(auto it = r.live.begin(); it != r.live.end(); it++)
+            if(*it == this) { r.live.erase(it); break; }
+    }
+};
+
+ThreadData &local()
+{
+    thread_local ThreadData td;
+    return td;
+}
+
+Registry::~Registry()
+{
+#ifdef HAVE_INSTRUMENT
+    if(size == 0) return;
+    Instrument::report(std::cerr);
+    if(const char *fname = std::getenv("ALIGN_TRACE"))
+    {
+        std::ofstream fout(fname);
+        for(auto &ent : folded) fout<<ent.first<<" "<<ent.second / 1000<<"\n";
+    }
+#endif
+}
+
+} // namespace
+
+Instrument::Scope::Scope(size_t id) : id_(id)
+{
+    auto &td = local();
+    const auto &name = registry().names[id];
+    td.stack.push_back({td.stack.empty() ? name : td.stack.back().path + ";" + name});
+    start_ = Clock_t::now();
+}
+
+Instrument::Scope::~Scope()
+{
+    uint64_t took = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            Clock_t::now() - start_).count();
+    auto &td = local();
+    td.count[id_].fetch_add(1, std::memory_order_relaxed);
+    td.nanos[id_].fetch_add(took, std::memory_order_relaxed);
+    auto frame = std::move(td.stack.back());
+    td.stack.pop_back();
+    td.folded[frame.path] += took > frame.children ? took - frame.children : 0;
+    if(!td.stack.empty()) td.stack.back().children += took;
+}
+
+size_t Instrument::probe(const std::string &name)
+{
+    auto &r = registry();
+    std::lock_guard<std::mutex> lock(r.mtx);
+    for(size_t i = 0; i < r.size; i++)
+        if(r.names[i] == name) return i;
+    if(r.size == MAX_PROBES) 
+        throw std::runtime_error("Instrument::probe: too many probes, at " + name);
+    r.names[r.size] = name;
+    return r.size++;
+}
+
+void Instrument::count(size_t id, uint64_t n)
+{
+    local().count[id].fetch_add(n, std::memory_order_relaxed);
+}
+
+std::vector<ProbeStat> Instrument::snapshot()
+{
+    auto &r = registry();
+    std::lock_guard<std::mutex> lock(r.mtx);
+    std::vector<ProbeStat> ret;
+    for(size_t i = 0; i < r.size; i++)
+    {
+        uint64_t count = r.count[i], nanos = r.nanos[i];
+        for(auto td : r.live)
+        {
+            count += td->count[i].load(std::memory_order_relaxed);
+            nanos += td->nanos[i].load(std::memory_order_relaxed);
+        }
+        ret.push_back({r.names[i], count, nanos * 1e-9});
+    }
+    return ret;
+}
+
+std::string Instrument::folded()
+{
+    auto &td = local();
+    auto &r = registry();
+    std::map<std::string, uint64_t> all;
+    {
+        std::lock_guard<std::mutex> lock(r.mtx);
+        all = r.folded;
+    }
+    for(auto &ent : td.folded) all[ent.first] += ent.second;
+    std::string ret;
+    for(auto &ent : all) ret += ent.first + " " + std::to_string(ent.second / 1000) + "\n";
+    return ret;
+}
+
+void Instrument::report(std::ostream &o)
+{
+    o<<std::left<<std::setw(40)<<"probe"<<std::right<<std::setw(14)<<"count"
+        <<std::setw(14)<<"seconds"<<std::endl;
+    for(auto &p : snapshot())
+    {
+        o<<std::left<<std::setw(40)<<p.name<<std::right<<std::setw(14)<<p.count
+            <<std::setw(14)<<std::fixed<<std::setprecision(6)<<p.seconds<<std::endl;
+    }
+}
+
+} // namespace src
@@ -0,0 +1,104 @@
+#ifndef _INSTRUMENT_HH_
+#define _INSTRUMENT_HH_
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <chrono>
+#include <ostream>
+
+namespace src
+{
+
+struct ProbeStat;
+class Instrument;
+
+/**
+ * struct ProbeStat
+ * calls (or counted events) of a probe and the time spent in its scopes,
+ * summed over all threads
+ */
+struct ProbeStat
+{
+    std::string name;
+    uint64_t count  = 0;
+    double seconds  = 0;
+};
+
+/**
+ * class Instrument
+ * named probes with per-thread atomic counters and scoped timers. The
+ * counters of a thread are folded into the totals when it exits; when
+ * built with INSTRUMENT=1 the totals are reported on stderr at exit, and
+ * written as folded stacks (flamegraph.pl input, in microseconds) to the
+ * file named by $ALIGN_TRACE if it is set.
+ * The INSTRUMENT_* macros below compile to nothing without INSTRUMENT=1
+ */
+class Instrument
+{
+    public:
+        using Clock_t = std::chrono::steady_clock;
+        constexpr static size_t MAX_PROBES = 128;
+
+        /**
+         * class Scope
+         * count a call of the probe and time it until the end of the scope,
+         * nested scopes of a thread form its stacks in the trace
+         */
+        class Scope
+        {
+            private:
+                size_t id_;
+                Clock_t::time_point start_;
+            public:
+                Scope(size_t id);
+                ~Scope();
+                Scope(const Scope &) = delete;
+                Scope &operator=(const Scope &) = delete;
+        };
+
+        /**
+         * static method: probe
+         * the id of the named probe, registered on the first call
+         */
+        static size_t probe(const std::string &name);
+
+        /**
+         * static method: count
+         * add n events to the probe on the calling thread
+         */
+        static void count(size_t id, uint64_t n = 1);
+
+        /**
+         * static method: snapshot
+         * totals of every probe, over the finished and running threads
+         */
+        static std::vector<ProbeStat> snapshot();
+
+        /**
+         * static method: folded
+         * folded stacks "outer;inner microseconds" of the self time of the
+         * scopes, over the finished threads and the calling one
+         */
+        static std::string folded();
+
+        /* print the snapshot as a table */
+        static void report(std::ostream &o);
+};
+
+} // namespace src
+
+#ifdef HAVE_INSTRUMENT
+#define INSTRUMENT_CAT_(a, b) a##b
+#define INSTRUMENT_CAT(a, b) INSTRUMENT_CAT_(a, b)
+#define INSTRUMENT_SCOPE(name) \
+    static const size_t INSTRUMENT_CAT(_instr_id_, __LINE__) = src::Instrument::probe(name); \
+    src::Instrument::Scope INSTRUMENT_CAT(_instr_scope_, __LINE__)(INSTRUMENT_CAT(_instr_id_, __LINE__))
+#define INSTRUMENT_COUNT(name, n) \
+    do { static const size_t _instr_id = src::Instrument::probe(name); \
+        src::Instrument::count(_instr_id, n); } while(0)
+#else
+#define INSTRUMENT_SCOPE(name) do {} while(0)
+#define INSTRUMENT_COUNT(name, n) do {} while(0)
+#endif
+
+#endif
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <limits>
+#include <unordered_map>
+#include "Refine.hh"
+
+namespace src
+{
+
+std::vector<double> Refiner::residuals(const TimeseriesView &small, const TimeseriesView &large,
+        const T delta_t, const T eps) const
+{
+    std::unordered_map<V, std::vector<int64_t>> index;
+    for(auto &ent : large)
+        index[ent.second].push_back(ent.first.ticks());
+
+    /* find the nearest same-valued large point of every small point */
+    const int64_t dt = delta_t.ticks(), e = eps.ticks();
+    std::vector<int64_t> ts, tl;
+    ts.reserve(small.size());
+    tl.reserve(small.size());
+    for(auto &ent : small)
+    {
+        auto it = index.find(ent.second);
+        if(it == index.end()) continue;
+        const auto &times = it->second;
+        auto target = ent.first.ticks() + dt;
+        auto pos = std::lower_bound(times.begin(), times.end(), target);
+        int64_t best = std::numeric_limits<int64_t>::max(), match = 0;
+        if(pos != times.end()) {best = *pos - target; match = *pos; }
+        if(pos != times.begin() && target - *(pos - 1) < best) 
+        {
+            best = target - *(pos - 1); 
+            match = *(pos - 1); 
+        }
+        if(best > e) continue;
+        ts.push_back(ent.first.ticks());
+        tl.push_back(match);
+    }
+
+    /* plain loop over contiguous arrays, vectorized by the compiler */
+    const size_t n = ts.size();
+    const double scale = 1. / Timestamp::USEC_SCALE;
+    std::vector<double> ret(n);
+    for(size_t i = 0; i < n; i++)
+        ret[i] = (tl[i] - ts[i] - dt) * scale;
+    return ret;
+}
+
+/* median of a sorted vector */
+static double sorted_median(const std::vector<double> &sorted)
+{
+    auto n = sorted.size();
+    if(n % 2) return sorted[n / 2];
+    return (sorted[n / 2 - 1] + sorted[n / 2]) / 2.;
+}
+
+/* median of the resample holding counts[i] copies of sorted[i] */
+static double counted_median(const std::vector<double> &sorted,
+        const std::vector<unsigned> &counts)
+{
+    auto n = sorted.size();
+    size_t lo = (n - 1) / 2, hi = n / 2;    // ranks of the median
+    size_t seen = 0, i = 0;
+    while(seen + counts[i] <= lo) seen += counts[i++];
+    double vlo = sorted[i];
+    while(seen + counts[i] <= hi) seen += counts[i++];
+    return (vlo + sorted[i]) / 2.;
+}
+
+/**
+ * largest 0-based rank k with P(B < k + 1) <= alpha, B ~ Binomial(n, 1/2):
+ * [x_k, x_{n-1-k}] of n sorted samples holds the median with probability
+ * at least 1 - 2 * alpha. 0 (the whole range) when n is too small for that.
+ * the sum starts 6 standard deviations below n/2, the tail before is < 1e-30
+ */
+static size_t median_rank(size_t n, double alpha)
+{
+    const double lnorm = std::lgamma(n + 1.) - n * std::log(2.);
+    const double skip = 3. * std::sqrt((double)n);
+    size_t k = n / 2 > skip ? static_cast<size_t>(n / 2 - skip) : 0;
+    double cdf = 0;
+    for(size_t i = k; i < n / 2; i++)
+    {
+        cdf += std::exp(lnorm - std::lgamma(i + 1.) - std::lgamma(n - i + 1.));
+        if(cdf > alpha) break;
+        k = i;
+    }
+    return k;
+}
+
+Estimate Refiner::estimate(std::vector<double> res, const T delta_t) const
+{
+    Estimate ret;
+    ret.matches = res.size();
+    if(res.empty()) return ret;
+    std::sort(res.begin(), res.end());
+    const size_t n = res.size();
+
+    ret.median = sorted_median(res);
+    size_t cut = std::min(static_cast<size_t>(n * trim_), (n - 1) / 2);
+    double sum = 0;
+    for(size_t i = cut; i < n - cut; i++) sum += res[i];
+    ret.trimmed_mean = sum / (n - 2 * cut);
+    ret.offset = (double)delta_t + ret.median;
+
+    double alpha = (1. - level_) / 2.;
+    if(rounds_ == 0)
+    {
+        size_t k = median_rank(n, alpha);
+        ret.ci_low  = (double)delta_t + res[k];
+        ret.ci_high = (double)delta_t + res[n - 1 - k];
+        return ret;
+    }
+
+    /**
+     * bootstrap the median: a resample is kept as the count of every
+     * sorted residual, so each round is O(n) without sorting
+     */
+    std::mt19937 engine(seed_);
+    std::uniform_int_distribution<size_t> dis(0, n - 1);
+    std::vector<unsigned> counts(n);
+    std::vector<double> medians(rounds_);
+    for(auto &m : medians)
+    {
+        std::fill(counts.begin(), counts.end(), 0);
+        for(size_t i = 0; i < n; i++) counts[dis(engine)]++;
+        m = counted_median(res, counts);
+    }
+    std::sort(medians.begin(), medians.end());
+    size_t il = static_cast<size_t>(alpha * (medians.size() - 1));
+    size_t ih = static_cast<size_t>((1. - alpha) * (medians.size() - 1) + 0.5);
+    ret.ci_low  = (double)delta_t + medians[il];
+    ret.ci_high = (double)delta_t + medians[ih];
+    return ret;
+}
+
+} // namespace src
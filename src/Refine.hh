@@ -0,0 +1,91 @@
+#ifndef _REFINE_HH_
+#define _REFINE_HH_
+#include <vector>
+#include <stdexcept>
+#include "Timeseries.hh"
+
+namespace test
+{
+class RefinerTest;
+} // namespace test
+
+namespace src
+{
+
+struct Estimate;
+class Refiner;
+
+/**
+ * struct Estimate
+ * the refined offset and its uncertainty, all values in seconds
+ */
+struct Estimate
+{
+    double offset       = NAN;  // delta_t + median residual
+    double median       = NAN;  // median residual
+    double trimmed_mean = NAN;  // trimmed mean residual
+    double ci_low       = NAN;  // confidence interval of offset
+    double ci_high      = NAN;
+    size_t matches      = 0;    // number of matched pairs
+};
+
+/**
+ * class Refiner
+ * refine a solved delta_t below the solver precision: match every small
+ * point to the nearest same-valued large point within eps, and estimate
+ * the offset from the residuals with a confidence interval of the median
+ */
+class Refiner
+{
+    friend class test::RefinerTest;
+    private:
+        using T = Timeseries::Time_t;
+        using V = Timeseries::Value_t;
+
+        double trim_;       // fraction trimmed at each side for the trimmed mean
+        double level_;      // confidence level of the interval
+        unsigned rounds_;   // bootstrap rounds, 0 for the order-statistic interval
+        unsigned seed_;     // seed of the bootstrap, results are reproducible
+
+    public:
+        /**
+         * the default interval is the distribution-free one given by the
+         * order statistics of the residuals, which costs nothing once they
+         * are sorted. rounds > 0 bootstraps the median instead, in
+         * O(rounds * n)
+         */
+        Refiner(double trim = 0.1, double level = 0.95, unsigned rounds = 0,
+                unsigned seed = 0)
+            : trim_(trim), level_(level), rounds_(rounds), seed_(seed)
+        {
+            if(!(level > 0. && level < 1.))
+                throw std::invalid_argument("Refiner: level must be in (0, 1)");
+        }
+
+        /**
+         * method residuals
+         * residuals (t_large - t_small - delta_t) of the matched pairs
+         */
+        std::vector<double> residuals(const TimeseriesView &small, const TimeseriesView &large,
+                const T delta_t, const T eps) const;
+
+        /**
+         * method estimate
+         * robust estimators and confidence interval of the given residuals
+         */
+        Estimate estimate(std::vector<double> res, const T delta_t) const;
+
+        /**
+         * method refine
+         * residuals() followed by estimate()
+         */
+        Estimate refine(const TimeseriesView &small, const TimeseriesView &large,
+                const T delta_t, const T eps) const
+        {
+            return this->estimate(this->residuals(small, large, delta_t, eps), delta_t);
+        }
+};
+
+} // namespace src
+
+#endif
@@ -0,0 +1,91 @@
+#include <sstream>
+#include <iomanip>
+#include <cstdio>
+#include "Result.hh"
+
+namespace src
+{
+
+void json_number(std::ostream &o, double v)
+{
+    if(std::isfinite(v)) o<<v;
+    else o<<"null";
+}
+
+void json_string(std::ostream &o, const std::string &str)
+{
+    o<<'"';
+    for(unsigned char c : str)
+    {
+        if(c == '"' || c == '\\') o<<'\\'<<c;
+        else if(c == '\n') o<<"\\n";
+        else if(c == '\t') o<<"\\t";
+        else if(c == '\r') o<<"\\r";
+        else if(c < 0x20)
+        {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            o<<buf;
+        }
+        else o<<c;
+    }
+    o<<'"';
+}
+
+static void json_phase(std::ostream &o, const char *name, const PhaseTime &p)
+{
+    o<<"\""<<name<<"\":{\"wall\":";
+    json_number(o, p.wall);
+    o<<",\"cpu\":";
+    json_number(o, p.cpu);
+    o<<"}";
+}
+
+void SolveResult::addStage(const std::string &name, size_t candidates, size_t pruned)
+{
+    for(auto &st : stages)
+    {
+        if(st.name != name) continue;
+        st.candidates += candidates;
+        st.pruned += pruned;
+        return;
+    }
+    stages.push_back({name, candidates, pruned});
+}
+
+std::string SolveResult::to_json() const
+{
+    std::ostringstream o;
+    o<<std::setprecision(12);
+    o<<"{\"solver\":";
+    json_string(o, solver);
+    o<<",\"offset\":";
+    json_number(o, offset);
+    o<<",\"epsilon\":";
+    json_number(o, epsilon);
+    o<<",\"candidates\":"<<generated<<",\"stages\":[";
+    for(size_t i = 0; i < stages.size(); i++)
+    {
+        if(i) o<<",";
+        o<<"{\"name\":";
+        json_string(o, stages[i].name);
+        o<<",\"candidates\":"<<stages[i].candidates
+            <<",\"pruned\":"<<stages[i].pruned<<"}";
+    }
+    o<<"],\"levels\":"<<levels<<",\"probes\":"<<probes<<",\"prefilter\":{\"tested\":"<<prefilter.tested
+        <<",\"passed\":"<<prefilter.passed<<",\"false_positives\":"<<prefilter.false_positives
+        <<"},\"matched_ratio\":";
+    json_number(o, matched_ratio);
+    o<<",\"time\":{";
+    json_phase(o, "load", load);
+    o<<",";
+    json_phase(o, "index", index);
+    o<<",";
+    json_phase(o, "generation", generation);
+    o<<",";
+    json_phase(o, "verification", verification);
+    o<<"}}";
+    return o.str();
+}
+
+} // namespace src
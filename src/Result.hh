@@ -0,0 +1,124 @@
+#ifndef _RESULT_HH_
+#define _RESULT_HH_
+#include <cmath>
+#include <ctime>
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace src
+{
+
+struct PhaseTime;
+class Stopwatch;
+struct StageStat;
+struct PrefilterStat;
+struct SolveResult;
+
+/**
+ * struct PhaseTime
+ * wall and cpu time (seconds) spent in one phase
+ */
+struct PhaseTime
+{
+    double wall = 0;
+    double cpu  = 0;
+
+    PhaseTime &operator+=(const PhaseTime &r) {wall += r.wall; cpu += r.cpu; return *this;}
+};
+
+/**
+ * class Stopwatch
+ * measure the wall and cpu time since construction or the last restart
+ */
+class Stopwatch
+{
+    private:
+        using Clock_t = std::chrono::steady_clock;
+        Clock_t::time_point wall_;
+        std::clock_t cpu_;
+    public:
+        Stopwatch() { restart(); }
+        void restart() { wall_ = Clock_t::now(); cpu_ = std::clock(); }
+        PhaseTime elapsed() const
+        {
+            PhaseTime ret;
+            ret.wall = std::chrono::duration<double>(Clock_t::now() - wall_).count();
+            ret.cpu  = (double)(std::clock() - cpu_) / CLOCKS_PER_SEC;
+            return ret;
+        }
+};
+
+/**
+ * struct StageStat
+ * number of candidates entering a pruning stage and how many it removed
+ */
+struct StageStat
+{
+    std::string name;
+    size_t candidates;
+    size_t pruned;
+};
+
+/**
+ * struct PrefilterStat
+ * candidates probed against the sketch, how many passed it, and how many
+ * of those the exact check on the same sample then rejected
+ */
+struct PrefilterStat
+{
+    size_t tested           = 0;
+    size_t passed           = 0;
+    size_t false_positives  = 0;
+
+    double false_positive_rate() const { return passed ? (double)false_positives / passed : 0; }
+};
+
+/**
+ * struct SolveResult
+ * result of SolverBase::solve with the work counters and timings
+ */
+struct SolveResult
+{
+    std::string solver;
+    double offset           = NAN;  // delta_t, NAN if no solution
+    double epsilon          = NAN;  // epsilon the solution was accepted at
+    size_t generated        = 0;    // candidates generated
+    std::vector<StageStat> stages;  // candidates pruned per stage
+    size_t levels           = 0;    // bisection levels (epsilons) tried
+    size_t probes           = 0;    // window lookups in the large series
+    PrefilterStat prefilter;        // empty without a sketch
+    double matched_ratio    = NAN;  // small points matched at offset, epsilon
+    PhaseTime load;                 // filled by the caller
+    PhaseTime index;                // lookup structures built by the solver
+    PhaseTime generation;
+    PhaseTime verification;
+
+    bool found() const { return !std::isnan(offset); }
+
+    /**
+     * method addStage
+     * add one pass of a stage to its counters, the stage is appended on
+     * first use: the passes of every bisection level share one entry
+     */
+    void addStage(const std::string &name, size_t candidates, size_t pruned);
+
+    /**
+     * method to_json
+     * export the result as a single line JSON object
+     */
+    std::string to_json() const;
+};
+
+/**
+ * json_number and json_string
+ * write a JSON number, null when it is not finite, and a quoted JSON
+ * string with its special characters escaped
+ */
+void json_number(std::ostream &o, double v);
+void json_string(std::ostream &o, const std::string &str);
+
+} // namespace src
+
+#endif
@@ -0,0 +1,59 @@
+#include <algorithm>
+#include "Sketch.hh"
+
+namespace src
+{
+
+uint64_t ValueTimeSketch::mix(uint64_t x)
+{
+    /* splitmix64 finalizer */
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+ValueTimeSketch::ValueTimeSketch(const TimeseriesView &series, T bucket, 
+        unsigned bits_per_point)
+    : bucket_(std::max<int64_t>(1, bucket.ticks())), mask_(63)
+{
+    uint64_t want = (uint64_t)series.size() * bits_per_point;
+    while(mask_ + 1 < want) mask_ = mask_ << 1 | 1;
+    bits_.assign((mask_ + 1) / 64, 0);
+    for(auto &ent : series)
+    {
+        auto t = ent.first.ticks();
+        int64_t b = t / bucket_ - (t % bucket_ < 0);
+        uint64_t h = mix(ent.second ^ mix(b));
+        for(unsigned i = 0; i < HASHES; i++)
+            set((h + i * (h >> 32 | 1)) & mask_);
+    }
+}
+
+bool ValueTimeSketch::contains(V value, int64_t bucket) const
+{
+    uint64_t h = mix(value ^ mix(bucket));
+    for(unsigned i = 0; i < HASHES; i++)
+        if(!get((h + i * (h >> 32 | 1)) & mask_)) return false;
+    return true;
+}
+
+bool ValueTimeSketch::mayContain(V value, T time, T eps) const
+{
+    auto lo = (time - eps).ticks(), hi = (time + eps).ticks();
+    int64_t blo = lo / bucket_ - (lo % bucket_ < 0);
+    int64_t bhi = hi / bucket_ - (hi % bucket_ < 0);
+    if(bhi - blo >= MAX_SPAN) return true;
+    for(auto b = blo; b <= bhi; b++)
+        if(this->contains(value, b)) return true;
+    return false;
+}
+
+double ValueTimeSketch::fillRatio() const
+{
+    size_t set = 0;
+    for(auto w : bits_) set += __builtin_popcountll(w);
+    return (double)set / bits();
+}
+
+} // namespace src
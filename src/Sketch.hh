@@ -0,0 +1,58 @@
+#ifndef _SKETCH_HH_
+#define _SKETCH_HH_
+#include <vector>
+#include <cstdint>
+#include "Timeseries.hh"
+
+namespace src
+{
+
+class ValueTimeSketch;
+
+/**
+ * class ValueTimeSketch
+ * Bloom filter over the (value, time bucket) pairs of a series, built once
+ * at load time. It answers whether a value may occur within eps of a time
+ * without false negatives, so a miss safely rejects a candidate delta_t
+ */
+class ValueTimeSketch
+{
+    private:
+        using T = Timeseries::Time_t;
+        using V = Timeseries::Value_t;
+
+        constexpr static unsigned HASHES = 2;
+        constexpr static int64_t MAX_SPAN = 64;    // wider queries always pass
+
+        int64_t bucket_;                // ticks per time bucket
+        uint64_t mask_;                 // number of bits - 1, a power of two
+        std::vector<uint64_t> bits_;
+
+        static uint64_t mix(uint64_t x);
+        void set(uint64_t bit) { bits_[bit >> 6] |= uint64_t(1) << (bit & 63); }
+        bool get(uint64_t bit) const { return bits_[bit >> 6] >> (bit & 63) & 1; }
+        bool contains(V value, int64_t bucket) const;
+    public:
+        /**
+         * constructor
+         * @params: bucket -- width of the time buckets, query windows wider
+         *                    than MAX_SPAN buckets are not filtered
+         *          bits_per_point -- size of the filter
+         */
+        ValueTimeSketch(const TimeseriesView &series, T bucket = 0.05, 
+                unsigned bits_per_point = 16);
+
+        /**
+         * method mayContain
+         * false only if no point of this value lies in [time - eps, time + eps]
+         */
+        bool mayContain(V value, T time, T eps) const;
+
+        /* fraction of bits set, the false positive rate per probe grows with it */
+        double fillRatio() const;
+        size_t bits() const { return mask_ + 1; }
+};
+
+} // namespace src
+
+#endif
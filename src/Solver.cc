@@ -1,32 +1,39 @@
 #include <iostream>
 #include <algorithm>
+#include <limits>
+#include <stdexcept>
 #include "Solver.hh"
 
 namespace src
 {
 
 const SolverBase::T SolverBase::NO_SOLUTION{NAN};
-bool SolverBase::check(const Timeseries &t1, const Timeseries &t2, 
+bool SolverBase::check(const TimeseriesView &t1, const TimeseriesView &t2, 
         const T delta_t, const T eps) const
 {
+    INSTRUMENT_SCOPE("SolverBase::check");
+    /* time of a window bound in the diagnostics, which may be past the end */
+    auto bound = [&t2](TimeseriesView::const_iterator it)
+    {
+        return it == t2.end() ? std::string("end") : it->first.to_string();
+    };
     /* t1 --> small; t2 --> large */
-    const auto &data1 = t1.getData();
-    const auto &data2 = t2.getData(); 
-    for(auto & ent : data1)
+    for(auto & ent : t1)
     {
         bool flag = false;      // found value ?
         auto t = ent.first;     // get time
         auto v = ent.second;    // get value
         auto rl = t + delta_t - eps;    // time range low bound
         auto rh = t + delta_t + eps;    // time range up bound
-        auto lb = data2.lower_bound(rl);    // iterator low bound
-        auto ub = data2.upper_bound(rh);    // iterator up bound
+        probes_++;
+        INSTRUMENT_COUNT("SolverBase::check probes", 1);
+        auto lb = t2.lower_bound(rl);    // iterator low bound
+        auto ub = t2.upper_bound(rh);    // iterator up bound
         if(std::distance(lb, ub) <= 0)
 		{
-			std::cerr<<"MESSAGE: SolverBase::check failed because out of range: ";
-            std::cerr<<"small time: "<<t.to_string()<<", delta_t: "<<delta_t
-				<<", range: "<<lb->first.to_string()<<","
-                <<ub->first.to_string()<<std::endl;
+			*log_<<"MESSAGE: SolverBase::check failed because out of range: ";
+            *log_<<"small time: "<<t.to_string()<<", delta_t: "<<delta_t
+				<<", range: "<<bound(lb)<<","<<bound(ub)<<std::endl;
 			return false;    // not in range
 		} 
         for(auto it = lb; it!=ub; it++)
@@ -39,122 +46,425 @@ bool SolverBase::check(const Timeseries &t1, const Timeseries &t2,
         }
         if(!flag) 
         {
-            std::cerr<<"MESSAGE: SolverBase::check: failed because no solution: ";
-            std::cerr<<"small time: "<<t.to_string()<<", delta_t: "<<delta_t
-				<<", range: "<<lb->first.to_string()<<","
-                <<ub->first.to_string()<<std::endl;
+            *log_<<"MESSAGE: SolverBase::check: failed because no solution: ";
+            *log_<<"small time: "<<t.to_string()<<", value: "<<Timeseries::untag(v)
+                <<" ("<<direction_name(Timeseries::direction(v))<<"), delta_t: "<<delta_t
+				<<", range: "<<bound(lb)<<","<<bound(ub)<<std::endl;
             return false;
         }
     }
-    std::cerr<<"MESSAGE: SolverBase::check: sucessed! ";
+    *log_<<"MESSAGE: SolverBase::check: sucessed! ";
+    return true;
+}
+
+unsigned SolverBase::directions(const TimeseriesView &ts)
+{
+    unsigned ret = 0;
+    for(auto &ent : ts) ret |= 1u << (unsigned)Timeseries::direction(ent.second);
+    return ret;
+}
+
+void SolverBase::check_directions(unsigned small, unsigned large)
+{
+    if(!small || !large || (small & large)) return;
+    auto names = [](unsigned mask)
+    {
+        std::string ret;
+        for(unsigned d = 0; d < 4; d++)
+        {
+            if(!(mask >> d & 1)) continue;
+            if(!ret.empty()) ret += "+";
+            ret += direction_name(Direction(d));
+        }
+        return ret;
+    };
+    throw std::invalid_argument("SolverBase: no direction in common, small is " + names(small)
+            + " and large is " + names(large) + ": tag both series or neither");
+}
+
+double SolverBase::matched_ratio(const TimeseriesView &t1, const TimeseriesView &t2,
+        const T delta_t, const T eps) const
+{
+    if(t1.empty()) return NAN;
+    size_t matched = 0;
+    for(auto &ent : t1)
+    {
+        auto lb = t2.lower_bound(ent.first + delta_t - eps);
+        auto ub = t2.upper_bound(ent.first + delta_t + eps);
+        for(auto it = lb; it != ub; it++)
+        {
+            if(it->second == ent.second) { matched++; break; }
+        }
+    }
+    return (double)matched / t1.size();
+}
+
+bool SolverBase::prefilter(const Flat_t &sample, const T delta_t, const T eps) const
+{
+    if(!sketch_) return true;
+    for(auto &ent : sample)
+        if(!sketch_->mayContain(ent.second, ent.first + delta_t, eps)) return false;
+    return true;
+}
+
+bool BruteForce::check_sampled(const Flat_t &sample, const Flat_t &large,
+        Candidate &cand, const T eps) const
+{
+    auto time_less = [](const Entry_t &ent, const T &t) { return ent.first < t; };
+    auto less_time = [](const T &t, const Entry_t &ent) { return t < ent.first; };
+    for(size_t i = 0; i < sample.size(); i++)
+    {
+        auto t = sample[i].first;
+        auto v = sample[i].second;
+        auto rl = t + cand.delta_t - eps;
+        auto rh = t + cand.delta_t + eps;
+        /* the new window lies inside the previous one */
+        probes_++;
+        INSTRUMENT_COUNT("BruteForce::check_sampled probes", 1);
+        auto first = large.begin() + cand.lo[i];
+        auto last  = large.begin() + cand.hi[i];
+        auto lb = std::lower_bound(first, last, rl, time_less);
+        auto ub = std::upper_bound(lb, last, rh, less_time);
+        cand.lo[i] = lb - large.begin();
+        cand.hi[i] = ub - large.begin();
+        if(lb == ub) return false;
+        if(std::find_if(lb, ub, [v](const Entry_t &ent){ return ent.second == v; }) == ub)
+            return false;
+    }
     return true;
 }
 
-double BruteForce::solve(const Timeseries &small, const Timeseries &large)
+SolveResult BruteForce::solve(const TimeseriesView &small, const TimeseriesView &large)
 {
+    INSTRUMENT_SCOPE("BruteForce::solve");
+    SolveResult ret;
+    ret.solver = "BruteForce";
+    probes_ = 0;
+    /* nothing to anchor the candidates on */
+    if(small.empty() || large.empty()) return ret;
+    check_directions(directions(small), directions(large));
+    Stopwatch watch;
+
     T l_eps = 0.0;
     T r_eps = this->epsilon_ * 2;
+    T last_eps = r_eps;     // epsilon of the last finished level
 
-    /* iterate all possible delta_t */
-    std::vector<T> possible_dt;
-    const auto T2 = large.getTimeSet();
     const auto T1 = small.getTimeSet();
-    std::cout<<"BruteForce::solve: sizes are: "<<T1.size()<<" "<<T2.size()<<std::endl;
-    for(auto t2 : T2)
+    *log_<<"BruteForce::solve: sizes are: "<<T1.size()<<" "<<large.size()<<std::endl;
+
+    /* flatten the large series and sample the small one (first point included) */
+    const Flat_t flat(large.begin(), large.end());
+    Flat_t sample;
+    size_t stride = std::max<size_t>(1, T1.size() / SAMPLE_SIZE);
+    size_t idx = 0;
+    for(auto &ent : small)
     {
-        auto t1 = T1[0];
-        if(std::fabs(t2 - t1) < 200)
-			possible_dt.push_back(t2 - t1);
+        if(idx++ % stride == 0) sample.push_back(ent);
     }
-    std::cout<<"BruteForce::solve: got "<<possible_dt.size()<<" possible delta_t"<<std::endl;
+    ret.index = watch.elapsed();
+    watch.restart();
 
-    /* modify the possible_dt, return the state:
-     *  retval > 0: more than 1 solution, need smaller eps
-     *  retval < 0: no solution, need larger eps
-     *  retval == 0: good! change the solution!
+    /**
+     * iterate all possible delta_t, the first small point can only match 
+     * a large point with the same (tagged) value
      */
-    auto one_try = [this, &small, &large](std::vector<T> &all_dt, T eps, T &solu)
+    std::vector<T> possible_dt;
+    const auto v1 = small.begin()->second;
     {
-        bool finished = false;
-        bool has_solu = false;
-        std::vector<T> new_dt;
-        for(auto delta_t : all_dt)
+        INSTRUMENT_SCOPE("BruteForce::generate");
+        for(auto &ent : large)
         {
-            auto res = this->check(small, large, delta_t, eps);
-            if(res)         // this dt can be solution
-            {
-				std::cerr<<"PASSED!! "<<all_dt.size()<<std::endl;
-                new_dt.push_back(delta_t);
-                if(!has_solu) solu = delta_t;
-                else // already got a solution
-                    finished = true;    // now finished!
-                has_solu = true;
-            }
+            auto t1 = T1[0];
+            if(ent.second == v1 && std::fabs(ent.first - t1) < (double)range_)
+                possible_dt.push_back(ent.first - t1);
         }
-        all_dt = new_dt;    // update all_dt
-        /**
-         * has_solu = true, finished = true: more than one solution
-         * has_solu = false, finished = true: invalid state
-         * has_solu = true, finished = false: just one solution
-         * has_solu = false, finished = false: no solution
-         */
-        if(has_solu && finished)
-            return 1;
-        if(!has_solu && finished)
-            throw std::runtime_error("BruteForce::solve: invalid state in one_try(), has_solu = false, finished = true");
-        if(has_solu && !finished) 
-            return 0;
-        if(!has_solu && !finished)
-            return -1;
-
-        // control will never reach here!
-        throw std::runtime_error("BruteForce::solve: invalid state in one_try()");
-    };
+    }
+    INSTRUMENT_COUNT("BruteForce candidates", possible_dt.size());
+    *log_<<"BruteForce::solve: got "<<possible_dt.size()<<" possible delta_t"<<std::endl;
+    ret.generated = possible_dt.size();
+
+    /**
+     * sort and merge the possible delta_t within cluster_tol_, every cluster
+     * is verified once at its center, with epsilon widened by its half width.
+     * The widest cluster bounds the epsilon that can be resolved
+     */
+    std::sort(possible_dt.begin(), possible_dt.end());
+    std::vector<Candidate> cands;
+    const int64_t tol = cluster_tol_.ticks();
+    int64_t max_width = 0;
+    for(size_t i = 0, j = 0; i < possible_dt.size(); i = j)
+    {
+        int64_t first = possible_dt[i].ticks(), sum = 0;
+        for(j = i; j < possible_dt.size() && possible_dt[j].ticks() - first <= tol; j++)
+            sum += possible_dt[j].ticks() - first;
+        size_t votes = j - i;
+        int64_t width = possible_dt[j - 1].ticks() - first;
+        max_width = std::max(max_width, width);
+        T center = votes == 1 ? possible_dt[i] : Timestamp::fromTicks(first + sum / (int64_t)votes);
+        cands.push_back({center, Timestamp::fromTicks((width + 1) / 2), votes,
+                std::vector<size_t>(sample.size(), 0),
+                std::vector<size_t>(sample.size(), flat.size()), true});
+    }
+    l_eps = Timestamp::fromTicks(max_width);
+    ret.addStage("cluster", possible_dt.size(), possible_dt.size() - cands.size());
+    ret.generation = watch.elapsed();
+    watch.restart();
 
     /* check_possible: check if all dt in set is in 2 * eps */
-    auto check_possible = [](const std::vector<T> &dt, T eps)
+    auto check_possible = [this](const std::vector<T> &dt, T eps)
     {
         auto max = *std::max_element(dt.begin(), dt.end());
         auto min = *std::min_element(dt.begin(), dt.end());
-        std::cerr<<", "<<dt.size()<<" solutions are very near... try to find the result "<<std::endl;
-        //for(auto v:dt) std::cerr<<v<<" "; std::cerr<<std::endl;
-        std::cerr<<"Max is "<<max.to_string()<<", Min is "<<min.to_string()<<", Range is "<<(max-min).to_string()<<std::endl;
+        *log_<<", "<<dt.size()<<" solutions are very near... try to find the result "<<std::endl;
+        *log_<<"Max is "<<max.to_string()<<", Min is "<<min.to_string()<<", Range is "<<(max-min).to_string()<<std::endl;
         if((double)(max - min) < 2 * eps) return true;
         else return false;
     };
 
-    int try_ret = 0;
+    /* fill the result once the solution is known */
+    auto finish = [&](T solu, T eps)
+    {
+        ret.offset = solu;
+        ret.epsilon = eps;
+        ret.matched_ratio = this->matched_ratio(small, large, solu, eps);
+        ret.probes = probes_;
+        ret.verification = watch.elapsed();
+        return ret;
+    };
+
     do
     {
-        T solu = NO_SOLUTION;
+        T solu = NO_SOLUTION, solu_slack = 0.;
         auto mid = (l_eps + r_eps)/2.;
-        std::cout<<"BruteForce::solve: trying epsilon: "<<mid.to_string()
-                <<", remaining: "<<possible_dt.size();
-        if((double)mid < 1e-3 && check_possible(possible_dt, mid))
+        /* the interval cannot be split any more: the candidates stay ambiguous */
+        if(!(l_eps < mid && mid < r_eps)) break;
+        ret.levels++;
+        *log_<<"BruteForce::solve: trying epsilon: "<<mid.to_string()
+                <<", remaining: "<<cands.size();
+        if((double)mid < 1e-3)
         {
-            // return average
-            T sum = 0;
-            for(auto v : possible_dt) sum += v;
-            return sum / (double)possible_dt.size();
+            /* survivors not verified at the last level get their full check now */
+            possible_dt.clear();
+            int64_t sum = 0, votes = 0;
+            for(auto &c : cands)
+            {
+                if(c.verified || this->check(small, large, c.delta_t, last_eps + c.slack))
+                {
+                    possible_dt.push_back(c.delta_t);
+                    sum += c.delta_t.ticks() * (int64_t)c.votes;
+                    votes += c.votes;
+                }
+            }
+            ret.addStage("final", cands.size(), cands.size() - possible_dt.size());
+            if(check_possible(possible_dt, mid))
+            {
+                // return average weighted by the votes
+                return finish(Timestamp::fromTicks(sum / votes), last_eps);
+            }
+        }
+
+        /**
+         * prune with the sampled check, then run the full check in order
+         * until two candidates pass: that decides the level, the rest are
+         * kept and verified at a tighter epsilon
+         */
+        int passed = 0;
+        size_t sampled = 0, full = 0;
+        std::vector<Candidate> level = cands;  // windows are shrunk in place
+        std::vector<Candidate> survivors;
+        size_t sketched = 0;
+        for(auto &c : cands)
+        {
+            if(sketch_)
+            {
+                ret.prefilter.tested++;
+                if(!this->prefilter(sample, c.delta_t, mid + c.slack)) continue;
+                ret.prefilter.passed++;
+                sketched++;
+            }
+            if(!this->check_sampled(sample, flat, c, mid + c.slack))
+            {
+                if(sketch_) ret.prefilter.false_positives++;
+                continue;
+            }
+            sampled++;
+            c.verified = false;
+            if(passed < 2)
+            {
+                full++;
+                if(!this->check(small, large, c.delta_t, mid + c.slack)) continue;
+                c.verified = true;
+                if(passed == 0) {solu = c.delta_t; solu_slack = c.slack; }
+                passed++;
+            }
+            survivors.push_back(std::move(c));
+        }
+        if(sketch_) ret.addStage("sketch", cands.size(), cands.size() - sketched);
+        ret.addStage("sampled", sketch_ ? sketched : cands.size(),
+                (sketch_ ? sketched : cands.size()) - sampled);
+        ret.addStage("full", full, sampled - survivors.size());
+        /**
+         * no candidate holds at mid: the search goes back to a larger
+         * epsilon, for which the shrunk windows are too narrow
+         */
+        if(passed == 0) cands = std::move(level);
+        else
+        {
+            cands = std::move(survivors);
+            last_eps = mid;
         }
-        try_ret = one_try(possible_dt, mid, solu);
-        if(try_ret == 0)
+
+        if(passed == 1)
         {
-            std::cout<<" found solution: "<<solu.to_string()<<std::endl;
-            return solu;
+            *log_<<" found solution: "<<solu.to_string()<<std::endl;
+            return finish(solu, mid + solu_slack);
         }
-        if(try_ret > 0)
+        if(passed > 1)
         {
-            std::cout<<", get more than 1 solutions"<<std::endl;
+            *log_<<", get more than 1 solutions"<<std::endl;
             r_eps = mid;
         }
-        if(try_ret < 0)
+        if(passed == 0)
         {
-            std::cout<<", get no solution"<<std::endl;
+            *log_<<", get no solution"<<std::endl;
             l_eps = mid;
         }
-    }while(possible_dt.size());
-    return NO_SOLUTION;
+    }while(cands.size());
+    ret.probes = probes_;
+    ret.verification = watch.elapsed();
+    return ret;
+}
+
+MinEpsilon::Tick_t MinEpsilon::min_epsilon(const Points_t &small,
+        const Index_t &index, const Tick_t delta_t, const Tick_t bound) const
+{
+    Tick_t ret = 0;
+    for(auto &ent : small)
+    {
+        auto it = index.find(ent.second);
+        if(it == index.end()) return std::numeric_limits<Tick_t>::max();
+        const auto &times = it->second;
+        auto target = ent.first + delta_t;
+        probes_++;
+        INSTRUMENT_COUNT("MinEpsilon::min_epsilon probes", 1);
+        auto pos = std::lower_bound(times.begin(), times.end(), target);
+        Tick_t dist = std::numeric_limits<Tick_t>::max();
+        if(pos != times.end()) dist = *pos - target;
+        if(pos != times.begin()) dist = std::min(dist, target - *(pos - 1));
+        ret = std::max(ret, dist);
+        if(ret > bound) return ret;
+    }
+    return ret;
+}
+
+SolveResult MinEpsilon::solve(const TimeseriesView &small, const TimeseriesView &large)
+{
+    INSTRUMENT_SCOPE("MinEpsilon::solve");
+    SolveResult ret;
+    ret.solver = "MinEpsilon";
+    check_directions(directions(small), directions(large));
+    Stopwatch watch;
+
+    /* per-value sorted timestamps of the large series */
+    Index_t index;
+    for(auto &ent : large)
+        index[ent.second].push_back(ent.first.ticks());
+    Points_t points;
+    points.reserve(small.size());
+    for(auto &ent : small)
+        points.emplace_back(ent.first.ticks(), ent.second);
+    ret.index = watch.elapsed();
+    watch.restart();
+    *log_<<"MinEpsilon::solve: sizes are: "<<points.size()<<" "
+        <<large.size()<<std::endl;
+    this->rank(points, index, ret, watch);
+    return ret;
+}
+
+SolveResult MinEpsilon::solve(const TimeseriesLog &small, const TimeseriesLog &large)
+{
+    INSTRUMENT_SCOPE("MinEpsilon::solve");
+    SolveResult ret;
+    ret.solver = "MinEpsilon";
+    Stopwatch watch;
+
+    /* the index is kept up to date by the log, only the range is read */
+    Points_t points;
+    points.reserve(small.size());
+    unsigned small_dirs = 0, large_dirs = 0;
+    small.forEach([&points, &small_dirs](const TimeseriesLog::Entry_t &ent)
+    {
+        points.emplace_back(ent.first.ticks(), ent.second); 
+        small_dirs |= 1u << (unsigned)Timeseries::direction(ent.second);
+    });
+    for(auto &ent : large.index())
+        large_dirs |= 1u << (unsigned)Timeseries::direction(ent.first);
+    check_directions(small_dirs, large_dirs);
+    *log_<<"MinEpsilon::solve: sizes are: "<<points.size()<<" "
+        <<large.size()<<std::endl;
+    this->rank(points, large.index(), ret, watch);
+    return ret;
+}
+
+void MinEpsilon::rank(const Points_t &points, const Index_t &index,
+        SolveResult &ret, Stopwatch &watch)
+{
+    probes_ = 0;
+    if(points.empty()) return;
+
+    /**
+     * possible delta_t within the search range, the first small point 
+     * can only match a large point with the same (tagged) value
+     */
+    const Tick_t range = range_.ticks();
+    std::vector<Tick_t> possible_dt;
+    auto anchor = index.find(points[0].second);
+    if(anchor != index.end())
+    {
+        INSTRUMENT_SCOPE("MinEpsilon::generate");
+        const auto &times = anchor->second;
+        auto lo = std::upper_bound(times.begin(), times.end(), points[0].first - range);
+        auto hi = std::lower_bound(lo, times.end(), points[0].first + range);
+        for(auto it = lo; it != hi; it++)
+            possible_dt.push_back(*it - points[0].first);
+    }
+    INSTRUMENT_COUNT("MinEpsilon candidates", possible_dt.size());
+    ret.generated = possible_dt.size();
+    ret.generation = watch.elapsed();
+    watch.restart();
+    INSTRUMENT_SCOPE("MinEpsilon::rank");
+
+    /* rank all possible delta_t by their minimal feasible epsilon */
+    Tick_t best_eps = this->epsilon_.ticks();
+    Tick_t best_dt = 0;
+    bool found = false;
+    size_t bounded = 0;
+    for(auto delta_t : possible_dt)
+    {
+        auto eps = this->min_epsilon(points, index, delta_t, best_eps);
+        if(eps > best_eps) bounded++;
+        if(eps < best_eps || (!found && eps == best_eps))
+        {
+            best_eps = eps;
+            best_dt = delta_t;
+            found = true;
+        }
+    }
+    ret.addStage("bound", possible_dt.size(), bounded);
+    ret.probes = probes_;
+    *log_<<"MinEpsilon::solve: ranked "<<possible_dt.size()<<" possible delta_t";
+    if(!found)
+    {
+        *log_<<", get no solution"<<std::endl;
+        ret.verification = watch.elapsed();
+        return;
+    }
+    *log_<<", found solution: "<<Timestamp::fromTicks(best_dt).to_string()
+        <<" with epsilon: "<<Timestamp::fromTicks(best_eps).to_string()<<std::endl;
+    ret.offset = Timestamp::fromTicks(best_dt);
+    ret.epsilon = Timestamp::fromTicks(best_eps);
+    ret.matched_ratio = 1;  // every small point matches at its minimal epsilon
+    ret.verification = watch.elapsed();
 }
 
 } // namespace src
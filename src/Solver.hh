@@ -1,12 +1,22 @@
 #ifndef _SOLVER_HH_
 #define _SOLVER_HH_
 #include <cmath>
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <unordered_map>
 #include "Timeseries.hh"
+#include "Result.hh"
+#include "TimeseriesLog.hh"
+#include "Sketch.hh"
 
 namespace test
 {
 class SolverTest; // export the classname here
 class BruteForceTest;
+class MinEpsilonTest;
+class TimeseriesViewTest;
+class DirectionTest;
 } // namespace test
 
 namespace src
@@ -14,6 +24,7 @@ namespace src
 
 class SolverBase;
 class BruteForce;
+class MinEpsilon;
 
 /**
  * class SolverBase
@@ -23,6 +34,9 @@ class SolverBase
 {
     friend class test::SolverTest;
     friend class test::BruteForceTest;
+    friend class test::MinEpsilonTest;
+    friend class test::TimeseriesViewTest;
+    friend class test::DirectionTest;
     protected:
         using T = Timeseries::Time_t;
         using V = Timeseries::Value_t;
@@ -31,22 +45,80 @@ class SolverBase
     public:
         const static T NO_SOLUTION; // default is 0
     protected:
+        using Entry_t = std::pair<T, V>;
+        using Flat_t  = std::vector<Entry_t>;
+
         T epsilon_; /* the expected error range */
+        T range_ = 200.; /* max |delta_t| searched */
+        mutable size_t probes_ = 0; /* window lookups in the large series */
+        const ValueTimeSketch *sketch_ = nullptr; /* of the large series */
+        std::ostream *log_ = &std::cerr; /* progress and diagnostics */
 
         /**
          * method check
          * check if the delta_t is valid using epsilon
 		 * small + delta_t = large
          */
-        bool check(const Timeseries &small, const Timeseries &large, 
+        bool check(const TimeseriesView &small, const TimeseriesView &large, 
+                const T delta_t, const T eps) const;
+
+        /**
+         * method matched_ratio
+         * fraction of small points having a same-valued large point 
+         * within eps of small + delta_t
+         */
+        double matched_ratio(const TimeseriesView &small, const TimeseriesView &large,
                 const T delta_t, const T eps) const;
+
+        /**
+         * method prefilter
+         * probe the sampled small points shifted by delta_t against the
+         * sketch, false if one of them surely has no match within eps.
+         * Always true without a sketch
+         */
+        bool prefilter(const Flat_t &sample, const T delta_t, const T eps) const;
+
+        /**
+         * static method: directions
+         * the directions of the points, bit d set for Direction d
+         */
+        static unsigned directions(const TimeseriesView &ts);
+
+        /**
+         * static method: check_directions
+         * throw std::invalid_argument if small and large have points but
+         * no direction in common: no point could ever match, e.g. a
+         * tagged series against an untagged one
+         */
+        static void check_directions(unsigned small, unsigned large);
     public:
         SolverBase(double e) : epsilon_(e) {}
+
+        /**
+         * method setSketch
+         * sketch of the large series used to reject candidates before
+         * the exact check, nullptr disables it. Not owned
+         */
+        void setSketch(const ValueTimeSketch *sketch) { sketch_ = sketch; }
+
+        /**
+         * method setRange
+         * only search delta_t with |delta_t| < range, default 200 seconds
+         */
+        void setRange(T range) { range_ = range; }
+
+        /**
+         * method setLog
+         * stream of the progress and diagnostic messages, std::cerr by
+         * default. Solvers running concurrently each need their own
+         */
+        void setLog(std::ostream &log) { log_ = &log; }
         /**
          * method solve
-         * solve the problem and return the delta_t
+         * solve the problem and return the delta_t with the statistics.
+         * Throws std::invalid_argument if the directions cannot match
          */
-        virtual double solve(const Timeseries &small, const Timeseries &large) = 0;
+        virtual SolveResult solve(const TimeseriesView &small, const TimeseriesView &large) = 0;
 
         virtual ~SolverBase() {}
 };
@@ -55,13 +127,94 @@ class SolverBase
  * class BruteForce
  * solver using brute force method:
  * iterate among all possible delta t and find the possible solution
- * by dividing the epsilon
+ * by dividing the epsilon. Near-identical delta t (e.g. from PDU bursts)
+ * are clustered and verified once. Each level first prunes the candidates
+ * with a sampled subset of the small series (against the sketch if set,
+ * then exactly), and the full check is only run on the survivors until
+ * the outcome of the level is known
  */
 class BruteForce : public SolverBase
 {
+    private:
+        /* number of small points used by the coarse (sampled) check */
+        constexpr static size_t SAMPLE_SIZE = 64;
+
+        /**
+         * struct Candidate
+         * a possible delta_t and, for every sampled small point, its window
+         * [lo, hi) in the flattened large series. epsilon only decreases
+         * between levels, so the windows only shrink and are searched from
+         * the previous positions instead of the whole series
+         */
+        struct Candidate
+        {
+            T delta_t;      // center of the cluster
+            T slack;        // half width of the cluster, added to epsilon
+            size_t votes;   // possible delta_t merged in the cluster
+            std::vector<size_t> lo, hi;
+            bool verified;  // passed the full check at the last level
+        };
+
+        T cluster_tol_;     // possible delta_t closer than this are merged
+
+        /**
+         * method check_sampled
+         * check the candidate against the sampled small points only,
+         * a necessary condition of check(), updates the candidate windows
+         */
+        bool check_sampled(const Flat_t &sample, const Flat_t &large,
+                Candidate &cand, const T eps) const;
+    public:
+        /**
+         * constructor
+         * @params: eps -- the initial epsilon
+         *          cluster_tol -- width of the clusters possible delta_t
+         *          are merged into before verification (default 10 us)
+         */
+        BruteForce(T eps, T cluster_tol = 1e-5) : SolverBase(eps), cluster_tol_(cluster_tol) {}
+        virtual SolveResult solve(const TimeseriesView &small, const TimeseriesView &large) override;
+};
+
+/**
+ * class MinEpsilon
+ * solver without epsilon bisection: for every possible delta t compute
+ * the minimal feasible epsilon, i.e. the max over small points of the
+ * distance to the nearest large point with the same value, and return
+ * the delta t with the smallest one. epsilon_ is the largest accepted
+ */
+class MinEpsilon : public SolverBase
+{
+    friend class test::MinEpsilonTest;
+    private:
+        using Tick_t    = int64_t;
+        using Points_t  = std::vector<std::pair<Tick_t, V>>;
+        using Index_t   = TimeseriesLog::Index_t;
+
+        /**
+         * method min_epsilon
+         * minimal feasible epsilon (in ticks) of delta_t in a single pass
+         * over the small points, stops as soon as the result exceeds bound
+         */
+        Tick_t min_epsilon(const Points_t &small, const Index_t &index,
+                const Tick_t delta_t, const Tick_t bound) const;
+
+        /**
+         * method rank
+         * rank the delta_t from the large times of the first small point's
+         * value (so of its direction too) around it and fill the result
+         */
+        void rank(const Points_t &small, const Index_t &index, 
+                SolveResult &ret, Stopwatch &watch);
     public:
-        BruteForce(T eps) : SolverBase(eps) {}
-        virtual double solve(const Timeseries &small, const Timeseries &large) override;
+        MinEpsilon(T eps) : SolverBase(eps) {}
+        virtual SolveResult solve(const TimeseriesView &small, const TimeseriesView &large) override;
+
+        /**
+         * method solve
+         * solve on append-optimized series, reusing the value index of 
+         * large instead of building it
+         */
+        SolveResult solve(const TimeseriesLog &small, const TimeseriesLog &large);
 };
 
 } // namespace src
@@ -0,0 +1,137 @@
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include "TimeParse.hh"
+
+namespace src
+{
+
+/* read exactly n digits */
+static bool read_digits(const char *&p, const char *end, int n, int64_t &out)
+{
+    out = 0;
+    for(int i = 0; i < n; i++, p++)
+    {
+        if(p >= end || *p < '0' || *p > '9') return false;
+        out = out * 10 + (*p - '0');
+    }
+    return true;
+}
+
+/* read a '.fraction' (if any) as ticks, digits beyond the tick are truncated */
+static bool read_fraction(const char *&p, const char *end, int64_t &ticks)
+{
+    ticks = 0;
+    if(p == end || *p != '.') return true;
+    p++;
+    int64_t scale = Timestamp::USEC_SCALE;
+    while(p < end && *p >= '0' && *p <= '9')
+    {
+        scale /= 10;
+        ticks += (*p - '0') * scale;    // 0 once past the last tick digit
+        p++;
+    }
+    return true;
+}
+
+TimestampParser::TimestampParser(Format format, const std::string &base_date,
+        double utc_offset_hours)
+    : format_(format), base_day_(0), 
+    utc_offset_(static_cast<int64_t>(std::llround(utc_offset_hours * 3600)))
+{
+    const char *p = base_date.c_str(), *end = p + base_date.size();
+    int64_t y, m, d;
+    if(!(read_digits(p, end, 4, y) && p < end && *p++ == '-' && read_digits(p, end, 2, m)
+                && p < end && *p++ == '-' && read_digits(p, end, 2, d) && p == end)
+            || m < 1 || m > 12 || d < 1 || d > 31)
+        throw std::runtime_error("TimestampParser: invalid base date " + base_date + ", need YYYY-MM-DD");
+    base_day_ = daysFromCivil(y, m, d);
+}
+
+int64_t TimestampParser::daysFromCivil(int64_t y, unsigned m, unsigned d)
+{
+    /* H. Hinnant's days_from_civil */
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+TimestampParser::Format TimestampParser::parseFormat(const std::string &name)
+{
+    if(name == "auto") return Format::AUTO;
+    if(name == "epoch") return Format::EPOCH;
+    if(name == "time") return Format::TIME_OF_DAY;
+    if(name == "datetime") return Format::DATE_TIME;
+    throw std::runtime_error("TimestampParser: unknown time format " + name);
+}
+
+bool TimestampParser::parseEpoch(const char *p, const char *end, Timestamp &out) const
+{
+    const char *begin = p;
+    bool neg = false;
+    if(p < end && (*p == '-' || *p == '+')) neg = (*p++ == '-');
+    int64_t sec = 0, ticks = 0;
+    const char *digits = p;
+    while(p < end && *p >= '0' && *p <= '9') sec = sec * 10 + (*p++ - '0');
+    read_fraction(p, end, ticks);
+    if(p == digits || (p == digits + 1 && *digits == '.')) return false;
+    if(p != end)
+    {
+        /* exponent or other notation: fall back to strtod */
+        std::string str(begin, end);
+        char *stop = nullptr;
+        double v = std::strtod(str.c_str(), &stop);
+        if(stop == str.c_str() || !std::isfinite(v)) return false;
+        out = Timestamp(v);
+        return true;
+    }
+    /* epoch seconds are utc already, the offset does not apply */
+    int64_t total = sec * Timestamp::USEC_SCALE + ticks;
+    out = Timestamp::fromTicks(neg ? -total : total);
+    return true;
+}
+
+bool TimestampParser::parseTimeOfDay(const char *p, const char *end, int64_t day,
+        Timestamp &out) const
+{
+    int64_t h, m, s, ticks;
+    if(!read_digits(p, end, 2, h) || p >= end || *p++ != ':') return false;
+    if(!read_digits(p, end, 2, m) || p >= end || *p++ != ':') return false;
+    if(!read_digits(p, end, 2, s) || !read_fraction(p, end, ticks) || p != end) return false;
+    if(h > 23 || m > 59 || s > 60) return false;
+    int64_t sec = day * 86400 + h * 3600 + m * 60 + s - utc_offset_;
+    out = Timestamp::fromTicks(sec * Timestamp::USEC_SCALE + ticks);
+    return true;
+}
+
+bool TimestampParser::parseDateTime(const char *p, const char *end, Timestamp &out) const
+{
+    int64_t y, m, d;
+    if(!read_digits(p, end, 4, y) || p >= end || *p++ != '-') return false;
+    if(!read_digits(p, end, 2, m) || p >= end || *p++ != '-') return false;
+    if(!read_digits(p, end, 2, d) || p >= end || (*p != ' ' && *p != 'T')) return false;
+    if(m < 1 || m > 12 || d < 1 || d > 31) return false;
+    return parseTimeOfDay(p + 1, end, daysFromCivil(y, m, d), out);
+}
+
+bool TimestampParser::parse(const std::string &str, Timestamp &out) const
+{
+    const char *p = str.c_str(), *end = p + str.size();
+    switch(format_)
+    {
+        case Format::EPOCH:       return parseEpoch(p, end, out);
+        case Format::TIME_OF_DAY: return parseTimeOfDay(p, end, base_day_, out);
+        case Format::DATE_TIME:   return parseDateTime(p, end, out);
+        case Format::AUTO:
+        default:
+            break;
+    }
+    if(str.find(':') == std::string::npos) return parseEpoch(p, end, out);
+    if(str.size() > 10 && str[4] == '-') return parseDateTime(p, end, out);
+    return parseTimeOfDay(p, end, base_day_, out);
+}
+
+} // namespace src
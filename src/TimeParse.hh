@@ -0,0 +1,66 @@
+#ifndef _TIMEPARSE_HH_
+#define _TIMEPARSE_HH_
+#include <string>
+#include "Timeseries.hh"
+
+namespace src
+{
+
+class TimestampParser;
+
+/**
+ * class TimestampParser
+ * parse textual times directly into integer Timestamp ticks, without a
+ * round-trip through double:
+ *  EPOCH:       1513927305.805584238
+ *  TIME_OF_DAY: 07:21:47.724255            (on the base date)
+ *  DATE_TIME:   2017-12-22 15:21:45.805584238 (or with 'T')
+ *  AUTO:        detect one of the above per field
+ * TIME_OF_DAY and DATE_TIME are local times with the given UTC offset,
+ * which is removed so that sources in different timezones share the
+ * same epoch
+ */
+class TimestampParser
+{
+    public:
+        enum class Format { AUTO, EPOCH, TIME_OF_DAY, DATE_TIME };
+    private:
+        Format format_;
+        int64_t base_day_;      // days since 1970-01-01 of the base date
+        int64_t utc_offset_;    // seconds, local time = utc + utc_offset_
+
+        bool parseEpoch(const char *p, const char *end, Timestamp &out) const;
+        bool parseTimeOfDay(const char *p, const char *end, int64_t day, Timestamp &out) const;
+        bool parseDateTime(const char *p, const char *end, Timestamp &out) const;
+    public:
+        /**
+         * constructor
+         * @params: base_date -- YYYY-MM-DD, the date of TIME_OF_DAY fields
+         *          utc_offset_hours -- e.g. 8 for UTC+8 local times
+         */
+        TimestampParser(Format format = Format::AUTO, 
+                const std::string &base_date = "1970-01-01",
+                double utc_offset_hours = 0);
+
+        /**
+         * method parse
+         * parse the field, false if it is not a valid time
+         */
+        bool parse(const std::string &str, Timestamp &out) const;
+
+        /**
+         * static method: daysFromCivil
+         * days since 1970-01-01 of a proleptic gregorian date
+         */
+        static int64_t daysFromCivil(int64_t y, unsigned m, unsigned d);
+
+        /**
+         * static method: parseFormat
+         * format from its name: auto, epoch, time, datetime
+         */
+        static Format parseFormat(const std::string &name);
+};
+
+} // namespace src
+
+#endif
@@ -1,8 +1,14 @@
 #include <numeric>
 #include <iostream>
 #include <algorithm>
+#include <fstream>
+#include <thread>
+#include <exception>
+#include <cstdlib>
+#include <cerrno>
 #include "Timeseries.hh"
 #include "common.hh"
+#include "TimeParse.hh"
 
 namespace src
 {
@@ -24,6 +30,17 @@ std::string Timestamp::to_string() const
     return std::to_string(outsec) + "." + zeros + std::to_string(outusec); 
 }
 
+const char *direction_name(Direction d)
+{
+    switch(d)
+    {
+        case Direction::ANY:        return "any";
+        case Direction::UPLINK:     return "uplink";
+        case Direction::DOWNLINK:   return "downlink";
+    }
+    return "unknown";
+}
+
 Timeseries::Time_Set_t Timeseries::getTimeSet() const
 {
     Time_Set_t ret;
@@ -40,42 +57,295 @@ Timeseries::Value_Set_t Timeseries::getValueSet() const
     return ret;
 }
 
-Timeseries TimeseriesReader::ReadTwoCols(const std::string &fname, const char delim)
+Timeseries &Timeseries::setDirection(Direction d)
 {
+    for(auto &ent : data_) ent.second = tag(ent.second, d);
+    return *this;
+}
 
+Timeseries Timeseries::select(Direction d) const
+{
+    Timeseries ret;
+    for(auto &ent : data_)
+    {
+        if(direction(ent.second) == d) ret.data_.emplace_hint(ret.data_.end(), ent);
+    }
+    return ret;
+}
+
+TimeseriesView::TimeseriesView(const Timeseries &ts, Time_t t_begin, Time_t t_end)
+    : series_(&ts), begin_(ts.getData().lower_bound(t_begin)), 
+    end_(ts.getData().lower_bound(t_end)), size_(0)
+{
+    if(!(t_begin < t_end)) end_ = begin_;
+    size_ = std::distance(begin_, end_);
+}
+
+TimeseriesView::const_iterator TimeseriesView::clamp(const_iterator it) const
+{
+    /* keys are unique, so positions compare as their times */
+    if(begin_ == end_) return end_;
+    if(it != series_->end() && it->first < begin_->first) return begin_;
+    if(end_ == series_->end()) return it;
+    if(it == series_->end() || !(it->first < end_->first)) return end_;
+    return it;
+}
+
+TimeseriesView TimeseriesView::slice(Time_t t_begin, Time_t t_end) const
+{
+    TimeseriesView ret(*this);
+    ret.begin_ = this->lower_bound(t_begin);
+    ret.end_ = t_begin < t_end ? this->lower_bound(t_end) : ret.begin_;
+    ret.size_ = std::distance(ret.begin_, ret.end_);
+    return ret;
+}
+
+Timeseries::Time_Set_t TimeseriesView::getTimeSet() const
+{
+    Timeseries::Time_Set_t ret;
+    ret.reserve(size_);
+    for(auto it = begin_; it != end_; it++) ret.push_back(it->first);
+    return ret;
+}
+
+Timeseries::Value_Set_t TimeseriesView::getValueSet() const
+{
+    Timeseries::Value_Set_t ret;
+    ret.reserve(size_);
+    for(auto it = begin_; it != end_; it++) ret.push_back(it->second);
+    return ret;
+}
+
+/**
+ * parse_time and parse_value
+ * parse a field without throwing, false if it is not a number. Values
+ * are non-negative and below 2^62, the top bits hold the direction
+ */
+static bool parse_time(const std::string &str, Timestamp &out,
+        const TimestampParser *parser)
+{
+    static const TimestampParser default_parser;
+    return (parser ? parser : &default_parser)->parse(str, out);
+}
+
+static bool parse_value(const std::string &str, Timeseries::Value_t &out)
+{
+    char *end = nullptr;
+    errno = 0;
+    long long v = std::strtoll(str.c_str(), &end, 10);
+    if(end == str.c_str() || errno == ERANGE || v < 0 
+            || (unsigned long long)v > Timeseries::MAX_VALUE) return false;
+    out = v;
+    return true;
+}
+
+Timeseries TimeseriesReader::ReadTwoCols(const std::string &fname, const char delim,
+        ReadMode mode, ReadStats *stats, const TimestampParser *parser)
+{
+    INSTRUMENT_SCOPE("TimeseriesReader::ReadTwoCols");
     Timeseries ret;
     src::input_helper helper(fname, delim);
     while(helper.hasNext())
     {
         auto vec = helper.next();
         if(vec.size() == 0) continue;
-        if(vec.size() < 2) 
+        T time;
+        V value;
+        if(vec.size() < 2 || !parse_time(vec[0], time, parser) || !parse_value(vec[1], value))
         {
-            std::cerr<<"Error occured in TimeseriesReader::ReadTwoCols"<<std::endl;
-            for(auto v:vec) std::cerr<<v<<" "; std::cerr<<std::endl;
-            throw std::runtime_error("TimeseriesReader::ReadTwoCols: need at least 2 column but only got 1 or 0");
+            helper.malformed(mode, "TimeseriesReader::ReadTwoCols");
+            continue;
         }
-        T time = std::stod(vec[0]);
-        V value= std::stoll(vec[1]);
         ret.insert(time, value);
     }
+    if(stats) *stats = helper.stats();
+    return ret;
+}
+
+/**
+ * parse the lines of buf into (time, value) pairs, following input_helper 
+ * and split(): '#' lines are comments, empty fields skipped
+ */
+static void parse_chunk(const std::string &buf, const char delim, ReadMode mode,
+        const TimestampParser *parser,
+        std::vector<std::pair<Timestamp, Timeseries::Value_t>> &out, ReadStats &stats)
+{
+    INSTRUMENT_SCOPE("TimeseriesReader::parse_chunk");
+    size_t pos = 0;
+    while(pos < buf.size())
+    {
+        size_t eol = buf.find('\n', pos);
+        if(eol == std::string::npos) eol = buf.size();
+        stats.lines++;
+        if(eol > pos && buf[pos] == '#') stats.comments++;
+        else
+        {
+            std::string cols[2];
+            int ncol = 0;
+            size_t p = pos;
+            while(p < eol && ncol < 2)
+            {
+                size_t q = p;
+                while(q < eol && buf[q] != delim) q++;
+                if(q > p) cols[ncol++] = buf.substr(p, q - p);
+                p = q + 1;
+            }
+            Timestamp time;
+            Timeseries::Value_t value;
+            if(ncol == 0) stats.skipped++;
+            else if(ncol < 2 || !parse_time(cols[0], time, parser) || !parse_value(cols[1], value))
+            {
+                stats.malformed++;
+                if(mode == ReadMode::STRICT)
+                    throw std::runtime_error("TimeseriesReader::ReadTwoColsParallel: "
+                            "malformed record: " + buf.substr(pos, eol - pos));
+            }
+            else out.emplace_back(time, value);
+        }
+        pos = eol + 1;
+    }
+}
+
+Timeseries TimeseriesReader::ReadTwoColsParallel(const std::string &fname,
+        const char delim, unsigned threads, ReadMode mode, ReadStats *stats,
+        const TimestampParser *parser)
+{
+    INSTRUMENT_SCOPE("TimeseriesReader::ReadTwoColsParallel");
+    using Run_t = std::vector<std::pair<T, V>>;
+    /* compressed files cannot be split by offset: stream them instead */
+    if(detect_compression(fname) != Compression::NONE)
+        return ReadTwoCols(fname, delim, mode, stats, parser);
+    std::ifstream fin(fname, std::ios::binary | std::ios::ate);
+    if(!fin) throw std::runtime_error("file not found!\n");
+    const size_t size = fin.tellg();
+    if(threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = std::max<size_t>(1, std::min<size_t>(threads, size / 4096 + 1));
+
+    /* chunk i starts right after the first newline at or after i * size / n */
+    std::vector<size_t> bounds{0};
+    for(unsigned i = 1; i < threads; i++)
+    {
+        size_t b = std::max<size_t>(bounds.back(), i * size / threads);
+        fin.seekg(b);
+        std::string rest;
+        if(std::getline(fin, rest)) b += rest.size() + 1;
+        else b = size;
+        bounds.push_back(std::min(b, size));
+    }
+    bounds.push_back(size);
+    fin.close();
+
+    /* parse every chunk into a sorted run, equal times in file order */
+    std::vector<Run_t> runs(threads);
+    std::vector<ReadStats> chunk_stats(threads);
+    std::vector<std::exception_ptr> errors(threads);
+    std::vector<std::thread> workers;
+    for(unsigned i = 0; i < threads; i++)
+    {
+        workers.emplace_back([&, i]()
+        {
+            try
+            {
+                std::ifstream in(fname, std::ios::binary);
+                std::string buf(bounds[i + 1] - bounds[i], '\0');
+                in.seekg(bounds[i]);
+                in.read(&buf[0], buf.size());
+                parse_chunk(buf, delim, mode, parser, runs[i], chunk_stats[i]);
+                std::stable_sort(runs[i].begin(), runs[i].end(),
+                        [](const std::pair<T, V> &l, const std::pair<T, V> &r){ return l.first < r.first; });
+            }catch(...)
+            {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for(auto &w : workers) w.join();
+    for(auto &e : errors) if(e) std::rethrow_exception(e);
+    if(stats)
+    {
+        *stats = ReadStats();
+        for(auto &st : chunk_stats) *stats += st;
+    }
+
+    /* merge neighbouring runs pairwise, the earlier run wins on ties */
+    INSTRUMENT_SCOPE("TimeseriesReader::merge");
+    auto time_less = [](const std::pair<T, V> &l, const std::pair<T, V> &r){ return l.first < r.first; };
+    while(runs.size() > 1)
+    {
+        std::vector<Run_t> merged;
+        for(size_t i = 0; i + 1 < runs.size(); i += 2)
+        {
+            Run_t out;
+            out.reserve(runs[i].size() + runs[i + 1].size());
+            std::merge(runs[i].begin(), runs[i].end(), runs[i + 1].begin(), runs[i + 1].end(),
+                    std::back_inserter(out), time_less);
+            merged.push_back(std::move(out));
+        }
+        if(runs.size() % 2) merged.push_back(std::move(runs.back()));
+        runs = std::move(merged);
+    }
+
+    Timeseries ret;
+    for(auto &ent : runs[0]) ret.insertSorted(ent.first, ent.second);
     return ret;
 }
 
 Timeseries TimeseriesReader::ReadByColId(const std::string &fname,
-        const int tcol, const int vcol, const char delim)
+        const int tcol, const int vcol, const char delim, ReadMode mode, ReadStats *stats,
+        const TimestampParser *parser)
 {
+    INSTRUMENT_SCOPE("TimeseriesReader::ReadByColId");
     Timeseries ret;
     src::input_helper helper(fname, delim);
     unsigned maxv = std::max(tcol, vcol);
     while(helper.hasNext())
     {
         auto vec = helper.next();
-        if(vec.size() < maxv) continue;
-        T time = std::stod(vec[tcol]);
-        V value= std::stoll(vec[vcol]);
+        if(vec.size() == 0) continue;
+        T time;
+        V value;
+        if(vec.size() <= maxv || !parse_time(vec[tcol], time, parser) || !parse_value(vec[vcol], value))
+        {
+            helper.malformed(mode, "TimeseriesReader::ReadByColId");
+            continue;
+        }
         ret.insert(time, value);
     }
+    if(stats) *stats = helper.stats();
+    return ret;
+}
+
+Timeseries TimeseriesReader::ReadPdcpLog(const std::string &fname, ReadMode mode,
+        ReadStats *stats, const TimestampParser *parser)
+{
+    INSTRUMENT_SCOPE("TimeseriesReader::ReadPdcpLog");
+    auto trim = [](const std::string &str)
+    {
+        auto b = str.find_first_not_of(" \t\r");
+        auto e = str.find_last_not_of(" \t\r");
+        return b == std::string::npos ? std::string() : str.substr(b, e - b + 1);
+    };
+    Timeseries ret;
+    src::input_helper helper(fname, '$');
+    while(helper.hasNext())
+    {
+        auto vec = helper.next();
+        if(vec.size() == 0) continue;
+        T time;
+        V value;
+        auto colon = vec.size() < 3 ? std::string::npos : vec[2].rfind(':');
+        if(colon == std::string::npos || !parse_time(trim(vec[0]), time, parser) 
+                || !parse_value(vec[2].substr(colon + 1), value))
+        {
+            helper.malformed(mode, "TimeseriesReader::ReadPdcpLog");
+            continue;
+        }
+        auto dir = Direction::ANY;
+        if(vec[1].find("_UL_") != std::string::npos) dir = Direction::UPLINK;
+        else if(vec[1].find("_DL_") != std::string::npos) dir = Direction::DOWNLINK;
+        ret.insertSorted(time, Timeseries::tag(value, dir));
+    }
+    if(stats) *stats = helper.stats();
     return ret;
 }
 
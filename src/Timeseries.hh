@@ -6,6 +6,8 @@
 #include <vector>
 #include <string>
 #include <cmath>
+#include "common.hh"
+#include "Instrument.hh"
 
 
 namespace src
@@ -13,7 +15,9 @@ namespace src
 
 class Timestamp;
 class Timeseries;
+class TimeseriesView;
 class TimeseriesReader;
+class TimestampParser;
 
 } //namespace src
 
@@ -28,7 +32,7 @@ namespace src
 class Timestamp
 {
     public:
-        constexpr static int64_t USEC_SCALE = 100000000;
+        constexpr static int64_t USEC_SCALE = 1000000000;
     public:
         //constexpr static Timestamp NAN{0};
     public:
@@ -67,9 +71,27 @@ class Timestamp
         /* convert to double */
         operator double() const {return sec + usec * 1. / USEC_SCALE;}
 
+        /* convert to and from integer ticks (1 tick = 1 / USEC_SCALE sec) */
+        constexpr int64_t ticks() const {return sec * USEC_SCALE + usec;}
+        static constexpr Timestamp fromTicks(int64_t t)
+        {
+            int64_t s = t / USEC_SCALE, us = t % USEC_SCALE;
+            if(us < 0) {us += USEC_SCALE; s -= 1; }
+            return Timestamp(s, us);
+        }
+
         std::string to_string() const; 
 };
 
+/**
+ * enum Direction
+ * the channel of a point (e.g. LTE uplink or downlink), kept in the top
+ * bits of its value so that points only match within one direction
+ */
+enum class Direction : unsigned { ANY = 0, UPLINK = 1, DOWNLINK = 2 };
+
+/* any, uplink or downlink */
+const char *direction_name(Direction d);
 
 class Timeseries
 {
@@ -79,6 +101,10 @@ class Timeseries
         using Time_Set_t    = std::vector<Time_t>;
         using Value_Set_t   = std::vector<Value_t>;
 
+        constexpr static unsigned DIRECTION_SHIFT = 62;
+        /* largest value that leaves the direction bits free */
+        constexpr static Value_t MAX_VALUE = (Value_t(1) << DIRECTION_SHIFT) - 1;
+
     private:
         using Data_t         = std::map<Time_t, Value_t>;
 
@@ -103,6 +129,29 @@ class Timeseries
         Value_Set_t getValueSet() const;
 
         const Data_t & getData() const {return this->data_;}
+
+        /**
+         * tag, untag and direction
+         * set, remove and get the direction tag of a value
+         */
+        static constexpr Value_t tag(Value_t v, Direction d)
+        {
+            return untag(v) | (Value_t(d) << DIRECTION_SHIFT);
+        }
+        static constexpr Value_t untag(Value_t v) { return v & MAX_VALUE; }
+        static constexpr Direction direction(Value_t v) { return Direction(v >> DIRECTION_SHIFT); }
+
+        /**
+         * method setDirection
+         * tag every point of this timeseries with the direction
+         */
+        Timeseries &    setDirection(Direction d);
+
+        /**
+         * method select
+         * the points of one direction, with their tags
+         */
+        Timeseries      select(Direction d) const;
         
         /* access the timeseries */
         iterator    begin() { return data_.begin(); }
@@ -121,14 +170,28 @@ class Timeseries
         Timeseries &    insert(Time_t time, Value_t value) 
         { 
             static Time_t eps{1e-8};
+            INSTRUMENT_COUNT("Timeseries::insert", 1);
             while(data_.count(time))
             {
+                INSTRUMENT_COUNT("Timeseries::insert duplicates", 1);
                 auto newtime = time + eps;
                 //std::cerr<<"Warning: Timeseries::insert: duplicate key! time: " + std::to_string(time) + ", modify the time to " + std::to_string(newtime)<<std::endl;
                 time = newtime;
             }
             data_.insert({time, value}); return *this;
         }
+        /**
+         * insertSorted
+         * insert at the end in O(1) when the times come in increasing
+         * order, otherwise the same as insert
+         */
+        Timeseries &    insertSorted(Time_t time, Value_t value)
+        {
+            if(!data_.empty() && !(data_.rbegin()->first < time))
+                return this->insert(time, value);
+            INSTRUMENT_COUNT("Timeseries::insertSorted", 1);
+            data_.emplace_hint(data_.end(), time, value); return *this;
+        }
         Timeseries &    insertBatch(const Time_Set_t &vt, const Value_Set_t &vs)
         {
             if(vt.size() != vs.size()) throw std::runtime_error("Timeseries::insertBatch: input length not equal!");
@@ -139,6 +202,48 @@ class Timeseries
 
 };
 
+/**
+ * class TimeseriesView
+ * non-owning slice [t_begin, t_end) of a Timeseries, no data is copied.
+ * A Timeseries converts implicitly to a view of all its points, so
+ * functions taking a view accept both. The series must outlive the view
+ */
+class TimeseriesView
+{
+    public:
+        using Time_t         = Timeseries::Time_t;
+        using const_iterator = Timeseries::const_iterator;
+    private:
+        const Timeseries *series_;
+        const_iterator begin_, end_;
+        size_t size_;
+
+        /* move an iterator of the series into [begin_, end_] */
+        const_iterator clamp(const_iterator it) const;
+    public:
+        TimeseriesView(const Timeseries &ts)
+            : series_(&ts), begin_(ts.begin()), end_(ts.end()), size_(ts.getData().size()) {}
+        TimeseriesView(const Timeseries &ts, Time_t t_begin, Time_t t_end);
+
+        const_iterator begin() const { return begin_; }
+        const_iterator end() const { return end_; }
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+
+        /* lower_bound and upper_bound of the series, limited to the view */
+        const_iterator lower_bound(const Time_t &t) const { return clamp(series_->getData().lower_bound(t)); }
+        const_iterator upper_bound(const Time_t &t) const { return clamp(series_->getData().upper_bound(t)); }
+
+        /**
+         * method slice
+         * sub-view [t_begin, t_end) of this view
+         */
+        TimeseriesView slice(Time_t t_begin, Time_t t_end) const;
+
+        Timeseries::Time_Set_t  getTimeSet() const;
+        Timeseries::Value_Set_t getValueSet() const;
+};
+
 /**
  * class TimeseriesReader
  * Read the timeseries data from file and get a timeseries
@@ -157,14 +262,43 @@ class TimeseriesReader
          * read the timeseries from file with 2 columns
          *  col1: timestamp
          *  col2: value
+         * malformed records throw (STRICT) or are skipped (SKIP), the line
+         * counters are written to stats if given. Times are parsed with
+         * parser, by default epoch seconds or auto-detected text formats
+         */
+        static Timeseries ReadTwoCols(const std::string &, const char delim = ' ',
+                ReadMode mode = ReadMode::STRICT, ReadStats *stats = nullptr,
+                const TimestampParser *parser = nullptr);
+
+        /**
+         * static method: ReadTwoColsParallel
+         * same as ReadTwoCols, but the file is split into newline aligned
+         * chunks parsed concurrently into sorted runs, which are merged.
+         * Points with equal times keep the file order. Compressed files
+         * are read as a stream by ReadTwoCols
+         * threads = 0 uses all hardware threads
          */
-        static Timeseries ReadTwoCols(const std::string &, const char delim = ' ');
+        static Timeseries ReadTwoColsParallel(const std::string &, const char delim = ' ',
+                unsigned threads = 0, ReadMode mode = ReadMode::STRICT, 
+                ReadStats *stats = nullptr, const TimestampParser *parser = nullptr);
 
         /**
          * static method: ReadByColID
          * read the timeseries from file with columnID specified by user
          */
-        static Timeseries ReadByColId(const std::string &, const int, const int, const char delim = ' '); 
+        static Timeseries ReadByColId(const std::string &, const int, const int, const char delim = ' ',
+                ReadMode mode = ReadMode::SKIP, ReadStats *stats = nullptr,
+                const TimestampParser *parser = nullptr); 
+
+        /**
+         * static method: ReadPdcpLog
+         * read a PDCP log with '$' separated records
+         *  2017-12-22 07:21:47.724255 $ LTE_PDCP_UL_Cipher_Data_PDU $ PDU Size: 54
+         * the values are tagged UPLINK or DOWNLINK by the _UL_ / _DL_ of
+         * the record type, other records are left untagged
+         */
+        static Timeseries ReadPdcpLog(const std::string &, ReadMode mode = ReadMode::SKIP,
+                ReadStats *stats = nullptr, const TimestampParser *parser = nullptr);
 
         /**
          * static method: ReadByColIds
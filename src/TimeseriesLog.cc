@@ -0,0 +1,76 @@
+#include <algorithm>
+#include "TimeseriesLog.hh"
+
+namespace src
+{
+
+static bool time_less(const TimeseriesLog::Entry_t &l, const TimeseriesLog::Entry_t &r)
+{
+    return l.first < r.first;
+}
+
+TimeseriesLog &TimeseriesLog::append(Time_t time, Value_t value)
+{
+    /* delta stays sorted, a late point goes after the equal times */
+    Entry_t ent{time, value};
+    if(delta_.empty() || !(time < delta_.back().first)) delta_.push_back(ent);
+    else delta_.insert(std::upper_bound(delta_.begin(), delta_.end(), ent, time_less), ent);
+
+    auto &ticks = index_[value];
+    auto t = time.ticks();
+    if(ticks.empty() || ticks.back() <= t) ticks.push_back(t);
+    else ticks.insert(std::upper_bound(ticks.begin(), ticks.end(), t), t);
+
+    if(delta_.size() > std::max(min_delta_, base_.size() / ratio_)) this->merge();
+    return *this;
+}
+
+void TimeseriesLog::merge()
+{
+    if(delta_.empty()) return;
+    auto mid = base_.size();
+    bool in_order = base_.empty() || !(delta_.front().first < base_.back().first);
+    base_.insert(base_.end(), delta_.begin(), delta_.end());
+    if(!in_order)
+        std::inplace_merge(base_.begin(), base_.begin() + mid, base_.end(), time_less);
+    delta_.clear();
+    merges_++;
+}
+
+std::vector<TimeseriesLog::Entry_t> TimeseriesLog::range(Time_t tl, Time_t th) const
+{
+    Entry_t lo{tl, 0}, hi{th, 0};
+    auto bl = std::lower_bound(base_.begin(), base_.end(), lo, time_less);
+    auto bh = std::upper_bound(bl, base_.end(), hi, time_less);
+    auto dl = std::lower_bound(delta_.begin(), delta_.end(), lo, time_less);
+    auto dh = std::upper_bound(dl, delta_.end(), hi, time_less);
+    std::vector<Entry_t> ret;
+    ret.reserve((bh - bl) + (dh - dl));
+    std::merge(bl, bh, dl, dh, std::back_inserter(ret), time_less);
+    return ret;
+}
+
+Timeseries::Time_Set_t TimeseriesLog::getTimeSet() const
+{
+    Timeseries::Time_Set_t ret;
+    ret.reserve(this->size());
+    this->forEach([&ret](const Entry_t &ent){ ret.push_back(ent.first); });
+    return ret;
+}
+
+Timeseries::Value_Set_t TimeseriesLog::getValueSet() const
+{
+    Timeseries::Value_Set_t ret;
+    ret.reserve(this->size());
+    this->forEach([&ret](const Entry_t &ent){ ret.push_back(ent.second); });
+    return ret;
+}
+
+Timeseries TimeseriesLog::toTimeseries() const
+{
+    Timeseries ret;
+    this->forEach([&ret](const Entry_t &ent){ ret.insertSorted(ent.first, ent.second); });
+    return ret;
+}
+
+} // namespace src
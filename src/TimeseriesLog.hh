@@ -0,0 +1,89 @@
+#ifndef _TIMESERIESLOG_HH_
+#define _TIMESERIESLOG_HH_
+#include <vector>
+#include <utility>
+#include <unordered_map>
+#include "Timeseries.hh"
+
+namespace src
+{
+
+class TimeseriesLog;
+
+/**
+ * class TimeseriesLog
+ * append-optimized timeseries for long running captures: an immutable
+ * sorted base plus a small sorted delta buffer, merged into the base once
+ * it grows past a fraction of it (LSM-style), so appends are amortized 
+ * O(1). Queries span both parts. The per-value index is updated on every
+ * append, so re-solving never rebuilds it from scratch.
+ * Unlike Timeseries, equal times are kept (in append order)
+ */
+class TimeseriesLog
+{
+    public:
+        using Time_t    = Timeseries::Time_t;
+        using Value_t   = Timeseries::Value_t;
+        using Tick_t    = int64_t;
+        using Entry_t   = std::pair<Time_t, Value_t>;
+        using Index_t   = std::unordered_map<Value_t, std::vector<Tick_t>>;
+    private:
+        std::vector<Entry_t> base_;     // sorted, only rewritten by merge()
+        std::vector<Entry_t> delta_;    // sorted, the recent appends
+        Index_t index_;                 // per-value sorted ticks of all entries
+        size_t min_delta_;              // merge once delta_ exceeds
+        size_t ratio_;                  //  max(min_delta_, base_ / ratio_)
+        size_t merges_ = 0;
+
+    public:
+        TimeseriesLog(size_t min_delta = 4096, size_t ratio = 8)
+            : min_delta_(std::max<size_t>(min_delta, 1)), ratio_(std::max<size_t>(ratio, 1)) {}
+
+        /**
+         * method append
+         * add a point, O(1) amortized when times come in order
+         */
+        TimeseriesLog &append(Time_t time, Value_t value);
+
+        /**
+         * method merge
+         * fold the delta buffer into the base, O(delta) when the delta
+         * is newer than the base, a linear merge otherwise
+         */
+        void merge();
+
+        size_t size() const { return base_.size() + delta_.size(); }
+        size_t deltaSize() const { return delta_.size(); }
+        size_t merges() const { return merges_; }
+        const Index_t &index() const { return index_; }
+
+        /**
+         * method range
+         * points with time in [tl, th] in time order, from base and delta
+         */
+        std::vector<Entry_t> range(Time_t tl, Time_t th) const;
+
+        /**
+         * method forEach
+         * visit all points in time order, merging base and delta on the fly
+         */
+        template<typename F> void forEach(F f) const
+        {
+            auto i = base_.begin(), j = delta_.begin();
+            while(i != base_.end() || j != delta_.end())
+            {
+                if(j == delta_.end() || (i != base_.end() && !(j->first < i->first))) f(*i++);
+                else f(*j++);
+            }
+        }
+
+        Timeseries::Time_Set_t  getTimeSet() const;
+        Timeseries::Value_Set_t getValueSet() const;
+
+        /* copy into a Timeseries (duplicate times are shifted as by insert) */
+        Timeseries toTimeseries() const;
+};
+
+} // namespace src
+
+#endif
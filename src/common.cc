@@ -17,4 +17,22 @@ std::vector<std::string> split(const std::string &str, char c)
     }
     return ret;
 }
+std::vector<std::string> split_fields(const std::string &str, char c)
+{
+    std::vector<std::string> ret;
+    if(str.empty()) return ret;
+    size_t pos = 0;
+    while(true)
+    {
+        size_t next = str.find(c, pos);
+        if(next == std::string::npos)
+        {
+            ret.emplace_back(str.substr(pos));
+            break;
+        }
+        ret.emplace_back(str.substr(pos, next - pos));
+        pos = next + 1;
+    }
+    return ret;
+}
 }// namespace src
@@ -4,31 +4,99 @@
 #include <string>
 #include <fstream>
 #include <stdexcept>
+#include <memory>
+#include "Compress.hh"
 
 namespace src
 {
 std::vector<std::string> split(const std::string &str, char c);
 
+/* split str by c, keeping empty fields (csv columns stay in place) */
+std::vector<std::string> split_fields(const std::string &str, char c);
+
+/**
+ * enum ReadMode
+ * what the readers do on a malformed record:
+ *  STRICT throws, SKIP counts it in ReadStats and continues
+ */
+enum class ReadMode { STRICT, SKIP };
+
+/**
+ * struct ReadStats
+ * per-file line counters of a reader
+ */
+struct ReadStats
+{
+    size_t lines     = 0;   // lines read
+    size_t skipped   = 0;   // empty lines (or only delimiters)
+    size_t comments  = 0;   // lines starting with '#'
+    size_t malformed = 0;   // records that could not be parsed
+
+    ReadStats &operator+=(const ReadStats &r)
+    {
+        lines += r.lines; skipped += r.skipped; 
+        comments += r.comments; malformed += r.malformed;
+        return *this;
+    }
+    std::string to_string() const
+    {
+        return std::to_string(lines) + " lines, " + std::to_string(skipped) + " skipped, "
+            + std::to_string(comments) + " comments, " + std::to_string(malformed) + " malformed";
+    }
+};
+
 class input_helper
 {
     private:
-        std::ifstream fin;
+        std::unique_ptr<std::istream> fin;  // plain or decompressing stream
         char deli;
+        bool keep_empty;                    // keep empty fields
+        ReadStats stats_;
     public:
-        input_helper(const std::string &s, char d = ',') : fin(s), deli(d)
+        input_helper(const std::string &s, char d = ',', bool keep = false) 
+            : fin(open_input(s)), deli(d), keep_empty(keep)
         { 
-            if(!fin) throw std::runtime_error("file not found!\n");
+            if(!*fin) throw std::runtime_error("file not found!\n");
             //std::getline(fin,this->header); 
         }
+        /**
+         * method next
+         * fields of the next line, empty for comments and empty lines
+         */
         std::vector<std::string> next()
         {
             std::string line{};
-            std::getline(fin, line);
-            if(line[0] == '#') line = ""; //ignore comments
-            return split(line,deli);
+            std::getline(*fin, line);
+            stats_.lines++;
+            if(!line.empty() && line[0] == '#') //ignore comments
+            {
+                stats_.comments++;
+                return {};
+            }
+            auto ret = keep_empty ? split_fields(line, deli) : split(line, deli);
+            if(ret.empty() || (ret.size() == 1 && ret[0].empty())) 
+            {
+                stats_.skipped++;
+                return {};
+            }
+            return ret;
+        }
+        /* no line left, a trailing newline does not yield an empty line */
+        bool hasNext(){return fin->peek() != std::char_traits<char>::eof();}
+
+        /**
+         * method malformed
+         * report a malformed record of the last line: throws in STRICT
+         * mode, otherwise only counts it
+         */
+        void malformed(ReadMode mode, const std::string &where)
+        {
+            stats_.malformed++;
+            if(mode == ReadMode::STRICT)
+                throw std::runtime_error(where + ": malformed record at line " 
+                        + std::to_string(stats_.lines));
         }
-        bool hasNext(){return !fin.eof();}
-        ~input_helper() {fin.close();}
+        const ReadStats &stats() const {return stats_;}
 };
 }// namespace src
 
@@ -16,25 +16,47 @@ class Test1 : public Test
         }
 };
 
-void inputgen(int size)
+void inputgen(int size, unsigned seed)
 {
     std::cerr<<"Generating input!"<<std::endl;
     Tester t;
-    t.emplace<TimeseriesGen>("data/test", 0, 180, 0, 1412, size);
+    t.emplace<TimeseriesGen>("data/test", 0, 180, 0, 1412, size, seed);
     t.start();
     std::cerr<<"Done!"<<std::endl;
 }
 
 int main(int argc, char *argv[])
 {
-    inputgen(2048);
+    /* bin/test [-j threads] */
+    unsigned threads = 1;
+    if(argc == 3 && std::string(argv[1]) == "-j") threads = std::stoul(argv[2]);
+    else if(argc != 1)
+    {
+        fprintf(stderr, "Usage: %s [-j threads]\n", argv[0]);
+        return -1;
+    }
+    inputgen(2048, 1);
     Tester t;
     t.emplace<TimestampTest>();
     t.emplace<TimeseriesTest>("data/testlarge.ts");
     t.emplace<TimeseriesTest>("data/testsmall.ts");
+    t.emplace<ParallelReadTest>("data/testlarge.ts");
+    t.emplace<CompressedReadTest>("data/testsmall.ts");
+    t.emplace<ReadStatsTest>();
+    t.emplace<TimestampParseTest>("data/real/1c.csv");
+    t.emplace<TimeseriesLogTest>();
+    t.emplace<TimeseriesViewTest>();
     t.emplace<SolverTest>("data/testsmall.ts");
     t.emplace<BruteForceTest>("data/testsmall.ts", "data/testlarge.ts",
+            -10.)->budget(1., 64 << 20);
+    t.emplace<ClusterTest>();
+    t.emplace<MinEpsilonTest>("data/testsmall.ts", "data/testlarge.ts",
+            -10.)->budget(1., 64 << 20);
+    t.emplace<RefinerTest>("data/testsmall.ts", "data/testlarge.ts",
             -10.);
-    t.start();
-    return 0;
+    t.emplace<FlowTest>();
+    t.emplace<DirectionTest>();
+    t.emplace<SketchTest>()->budget(2., 256 << 20);
+    t.emplace<InstrumentTest>();
+    return t.start(true, threads) == t.size() ? 0 : 1;
 }
@@ -0,0 +1,49 @@
+#include <random>
+#include <fstream>
+#include "Synthetic.hh"
+
+namespace test
+{
+
+void SyntheticGen::generate(src::Timeseries &small, src::Timeseries &large) const
+{
+    using V = src::Timeseries::Value_t;
+    std::mt19937_64 engine(cfg_.seed);
+    std::exponential_distribution<double> dis_gap(cfg_.rate);
+    std::uniform_real_distribution<double> dis_err(-cfg_.jitter, cfg_.jitter);
+    std::uniform_real_distribution<double> dis_p(0, 1);
+    std::uniform_int_distribution<V> dis_v(40, 1500);
+
+    std::vector<V> pool(std::max<size_t>(cfg_.values, 1));
+    for(auto &v : pool) v = dis_v(engine);
+    std::uniform_int_distribution<size_t> dis_idx(0, pool.size() - 1);
+
+    small.clear();
+    large.clear();
+    double t = 0;
+    unsigned in_burst = 0;
+    for(size_t i = 0; i < cfg_.len; i++)
+    {
+        if(in_burst) in_burst--;    // same timestamp as the previous point
+        else
+        {
+            t += dis_gap(engine);
+            if(dis_p(engine) < cfg_.burst) in_burst = cfg_.burst_len - 1;
+        }
+        auto v = pool[dis_idx(engine)];
+        large.insert(t, v);
+        if(dis_p(engine) < cfg_.loss) continue;
+        small.insert(t * (1 + cfg_.drift * 1e-6) + cfg_.offset + dis_err(engine), v);
+    }
+}
+
+void SyntheticGen::write(const std::string &prefix) const
+{
+    src::Timeseries small, large;
+    this->generate(small, large);
+    std::ofstream fout_l(prefix + "large.ts"), fout_s(prefix + "small.ts");
+    for(auto &ent : large) fout_l<<ent.first.to_string()<<" "<<ent.second<<"\n";
+    for(auto &ent : small) fout_s<<ent.first.to_string()<<" "<<ent.second<<"\n";
+}
+
+} // namespace test
@@ -0,0 +1,63 @@
+#ifndef _SYNTHETIC_HH_
+#define _SYNTHETIC_HH_
+
+#include <string>
+#include <stdexcept>
+#include "../src/Timeseries.hh"
+
+namespace test
+{
+
+class SyntheticGen;
+
+/**
+ * class SyntheticGen
+ * seeded generator of a (small, large) timeseries pair, where
+ *  small = large + offset (+ drift, jitter), with some points lost.
+ * Times are drawn as exponential gaps, so no rejection sampling is
+ * needed and millions of points are generated in linear time
+ */
+class SyntheticGen
+{
+    public:
+        struct Config
+        {
+            size_t len          = 2048;     // points in the large series
+            double rate         = 100;      // mean points per second
+            double offset       = 10;       // small time - large time
+            double loss         = 0.3;      // fraction of points missing in small
+            double jitter       = 0.005;    // max abs error added to small times
+            double burst        = 0.01;     // probability a point starts a burst
+            unsigned burst_len  = 8;        // points sharing the burst timestamp
+            double drift        = 0;        // clock drift of small, in ppm
+            size_t values       = 64;       // distinct values
+            unsigned seed       = 0;
+        };
+    private:
+        Config cfg_;
+    public:
+        SyntheticGen(const Config &cfg) : cfg_(cfg)
+        {
+            if(cfg_.burst_len == 0)
+                throw std::invalid_argument("SyntheticGen: burst_len must be at least 1");
+        }
+
+        const Config &config() const { return cfg_; }
+
+        /**
+         * method generate
+         * fill the two series, same seed gives the same series
+         */
+        void generate(src::Timeseries &small, src::Timeseries &large) const;
+
+        /**
+         * method write
+         * generate and write ${prefix}small.ts and ${prefix}large.ts
+         * in the two column format of TimeseriesReader::ReadTwoCols
+         */
+        void write(const std::string &prefix) const;
+};
+
+} // namespace test
+
+#endif
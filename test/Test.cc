@@ -1,12 +1,61 @@
 #include <stdexcept>
 #include <typeinfo>
 #include <iostream>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <cstdlib>
+#include <new>
 #include "Test.hh"
 
+/* ====================== Allocation counter ======================== */
+/**
+ * every replaceable form of C++14 is replaced, so that all of them pair
+ * malloc with free (the aligned ones are C++17)
+ */
+static thread_local size_t allocated_bytes = 0;
+
+static void *counted_malloc(std::size_t n) noexcept
+{
+    allocated_bytes += n;
+    return std::malloc(n ? n : 1);
+}
+
+void *operator new(std::size_t n)
+{
+    if(void *p = counted_malloc(n)) return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t n)
+{
+    if(void *p = counted_malloc(n)) return p;
+    throw std::bad_alloc();
+}
+
+void *operator new(std::size_t n, const std::nothrow_t &) noexcept { return counted_malloc(n); }
+void *operator new[](std::size_t n, const std::nothrow_t &) noexcept { return counted_malloc(n); }
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+void operator delete(void *p, const std::nothrow_t &) noexcept { std::free(p); }
+void operator delete[](void *p, const std::nothrow_t &) noexcept { std::free(p); }
+
+size_t test::allocated()
+{
+    return allocated_bytes;
+}
+
 using namespace test;
+using Clock_t = std::chrono::steady_clock;
+
 bool Test::operator()(void) noexcept
 {
     bool passed = false;
+    auto start = Clock_t::now();
+    auto alloc = test::allocated();
     try
     {
         passed = this->run();
@@ -16,6 +65,21 @@ bool Test::operator()(void) noexcept
         fprintf(stderr, "%s\n", _construct_err(err).c_str());
         return false;
     }
+    elapsed_ = std::chrono::duration<double>(Clock_t::now() - start).count();
+    allocated_ = test::allocated() - alloc;
+
+    if(passed && time_budget_ > 0 && elapsed_ > time_budget_)
+    {
+        fprintf(stderr, "%s\n", _construct_err("took " + std::to_string(elapsed_)
+                    + " s, the budget is " + std::to_string(time_budget_) + " s").c_str());
+        return false;
+    }
+    if(passed && alloc_budget_ > 0 && allocated_ > alloc_budget_)
+    {
+        fprintf(stderr, "%s\n", _construct_err("allocated " + std::to_string(allocated_)
+                    + " bytes, the budget is " + std::to_string(alloc_budget_)).c_str());
+        return false;
+    }
 
     if(passed)
     {
@@ -44,7 +108,9 @@ std::string Test::_construct_err(const std::string &err) const
 std::string Test::_construct_pass() const
 {
     std::string name {this->getName()};
-    return "\033[32m================ Test " + name + " Passed! "
+    char took[64];
+    snprintf(took, sizeof(took), "(%.3f s, %zu KiB) ", elapsed_, allocated_ / 1024);
+    return "\033[32m================ Test " + name + " Passed! " + took +
         "=================\033[0m";
 }
 
@@ -59,19 +125,43 @@ void Tester::enqueue(Test *pt)
     this->enqueue(std::shared_ptr<Test>(pt));
 }
 
-void Tester::start(bool stopOnFail)
+size_t Tester::start(bool stopOnFail, unsigned threads)
 {
-    int count = 0;
+    auto start = Clock_t::now();
+    std::atomic<size_t> count{0};
+    std::atomic<bool> failed{false};
+
+    /* the concurrent tests take the next one until none is left */
+    std::vector<std::shared_ptr<Test>> shared, exclusive;
     for(auto &pt : this->vec)
+        (threads > 1 && !pt->exclusive() ? shared : exclusive).push_back(pt);
+    std::atomic<size_t> next{0};
+    auto work = [&]()
+    {
+        for(size_t i = next++; i < shared.size(); i = next++)
+        {
+            if(stopOnFail && failed) break;
+            if((*shared[i])()) count++;
+            else failed = true;
+        }
+    };
+    std::vector<std::thread> workers;
+    for(unsigned i = 0; i < threads && i < shared.size(); i++)
+        workers.emplace_back(work);
+    for(auto &w : workers) w.join();
+
+    for(auto &pt : exclusive)
     {
-        auto passed = (*pt)();
-        if(stopOnFail && (!passed))
-            break;
-        count+=1;
+        if(stopOnFail && failed) break;
+        if((*pt)()) count++;
+        else failed = true;
     }
+
+    double took = std::chrono::duration<double>(Clock_t::now() - start).count();
     std::string str{std::to_string(count) + "/" + std::to_string(this->vec.size()) + " tests"};
-    fprintf(stderr, "\033[32m================ Finished, %s Passed! "
-        "=================\033[0m\n", str.c_str());
+    fprintf(stderr, "\033[32m================ Finished, %s Passed! (%.3f s) "
+        "=================\033[0m\n", str.c_str(), took);
+    return count;
 }
 
 
@@ -87,3 +177,19 @@ void Assert(bool cond, const char *file, int line, const char *func, const char
         throw std::runtime_error(err);
     }
 }
+
+void AssertTime(const std::function<void()> &fn, double sec, const char *expr,
+        const char *file, int line, const char *func)
+{
+    auto start = Clock_t::now();
+    fn();
+    double took = std::chrono::duration<double>(Clock_t::now() - start).count();
+    if(took > sec)
+    {
+        std::string err{"Assertion failed at function "};
+        err = err + func + "() in " + file + ":" + std::to_string(line);
+        err += " expression '" + std::string(expr) + "' took " + std::to_string(took)
+            + " s, the budget is " + std::to_string(sec) + " s";
+        throw std::runtime_error(err);
+    }
+}
@@ -5,12 +5,14 @@
 #include <memory>
 #include <vector>
 #include <iostream>
+#include <functional>
 
 #define TEST(obj) (obj)()
 #define ASSERT(cond) Assert(cond, __FILE__, __LINE__, __func__, NULL)
 #define ASSERT_WITH(cond, str) Assert(cond, __FILE__, __LINE__, __func__, str)
 #define ASSERT_FAULT(expr) AssertFault(expr, __FILE__, __LINE__, __func__)
 #define ASSERT_EQUAL(l, r) AssertEqual(l, r, __FILE__, __LINE__, __func__)
+#define ASSERT_TIME(sec, ...) AssertTime([&]{ __VA_ARGS__; }, sec, #__VA_ARGS__, __FILE__, __LINE__, __func__)
 
 #define AssertFault(e, fi, li, fu)  \
     try{ \
@@ -20,6 +22,8 @@
     "() in " + fi + ":" + std::to_string(li) + " expression \'" #e "\' should fail but it did not");}
 
 void Assert(bool cond, const char *f, int l, const char *fu, const char *extra);
+void AssertTime(const std::function<void()> &fn, double sec, const char *expr,
+        const char *f, int l, const char *fu);
 template<typename T> void AssertEqual(T l, T r, const char *file, int line, const char *func)
 {
     std::equal_to<T> eq;
@@ -37,9 +41,21 @@ namespace test
 {
 
 
+/**
+ * method allocated
+ * bytes allocated with operator new by the calling thread so far. The
+ * counter is thread local: threads started by the caller count on their own
+ */
+size_t allocated();
+
 class Test
 {
     private:
+        double elapsed_ = 0;        // wall time of the last run, seconds
+        size_t allocated_ = 0;      // bytes allocated by the last run, on its thread
+        double time_budget_ = 0;    // 0: no budget
+        size_t alloc_budget_ = 0;
+
         std::string _construct_err(const std::string &err) const;
         std::string _construct_pass() const;
     public:
@@ -47,6 +63,30 @@ class Test
         virtual bool run() = 0;
         virtual bool operator()(void) noexcept final;
         virtual ~Test() = default;
+
+        /**
+         * Method budget
+         * fail the test if a run takes more than seconds of wall time or
+         * allocates more than bytes (0: unlimited). Only the allocations of
+         * the thread running the test count: those of the threads it starts,
+         * e.g. parallel readers or FlowAligner workers, are not in the budget
+         */
+        Test &budget(double seconds, size_t bytes = 0)
+        {
+            time_budget_ = seconds;
+            alloc_budget_ = bytes;
+            return *this;
+        }
+
+        /**
+         * Method exclusive
+         * tests that must not share the machine with others, such as the
+         * ones with a time budget, are run alone after the concurrent ones
+         */
+        virtual bool exclusive() const { return time_budget_ > 0; }
+
+        double elapsed() const { return elapsed_; }
+        size_t allocated() const { return allocated_; }
 };
 
 class Tester
@@ -63,14 +103,18 @@ class Tester
         void enqueue(std::shared_ptr<Test> pt);
         void enqueue(Test *pt);
 
+        size_t size() const { return vec.size(); }
+
         /**
          * Method emplace
          * emplace a test object
          */
         template<typename T, typename... Args>
-            void emplace(Args &&... args)
+            std::shared_ptr<T> emplace(Args &&... args)
             {
-                this->enqueue(std::make_shared<T>(args...));
+                auto pt = std::make_shared<T>(args...);
+                this->enqueue(pt);
+                return pt;
             }
 
         /**
@@ -78,8 +122,11 @@ class Tester
          * Start the tests. 
          * If stopOnFail is set to true, it will stop when a test is failed
          * @params: stopOnFail -- default is true
+         *          threads -- run the tests which are not exclusive on a
+         *                     pool of threads, default is 1 (in order)
+         * @return: number of passed tests
          */
-        void start(bool stopOnFail = true);
+        size_t start(bool stopOnFail = true, unsigned threads = 1);
 
 };
 
@@ -1,14 +1,28 @@
 #include <random>
+#include <thread>
 #include <fstream>
+#include <sstream>
 #include <ctime>
 #include <set>
 #include <algorithm>
+#include <limits>
+#include <cstdio>
+#include <iterator>
+#include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
 #include "../src/Timeseries.hh"
 #include "../src/Solver.hh"
+#include "../src/Refine.hh"
+#include "../src/Compress.hh"
+#include "../src/TimeParse.hh"
+#include "../src/Flow.hh"
+#include "../src/Sketch.hh"
+#include "../src/Instrument.hh"
 #include "common_test.hh"
+#include "Synthetic.hh"
 
-static std::random_device _rd;
-static std::ranlux24 global_random_engine(_rd());
 
 
 namespace test
@@ -56,10 +70,33 @@ bool TimestampTest::run()
     return true;
 }
 
+std::string TimeseriesGen::stamp() const
+{
+    std::ostringstream o;
+    o.precision(17);
+    o<<tl<<" "<<th<<" "<<vl<<" "<<vh<<" "<<len<<" "<<seed;
+    return o.str();
+}
+
 bool TimeseriesGen::run()
 {
     using T = src::Timeseries::Time_t;
     using V = src::Timeseries::Value_t;
+    std::string largef = prefix + "large.ts",
+                smallf = prefix + "small.ts",
+                stampf = prefix + "gen.stamp";
+
+    /* reuse the files generated with the same parameters */
+    {
+        std::ifstream fin_stamp(stampf), fin_l(largef), fin_s(smallf);
+        std::string last;
+        if(fin_l && fin_s && std::getline(fin_stamp, last) && last == stamp())
+        {
+            std::cerr<<"Input data is up to date: "<<stampf<<std::endl;
+            return true;
+        }
+    }
+    std::ranlux24 engine(seed);
 
     /* initialize error range */
     static double epsilon = 0.01; // 10 ms
@@ -79,29 +116,29 @@ bool TimeseriesGen::run()
     {
         T v = 0;
         do{
-            v = dis_r(global_random_engine);
+            v = dis_r(engine);
         }while(timeset.count(v) > 0);
         timeset.insert(v);
     }
     std::cerr<<" Done, value: ";
-    for(auto &v : valueset) v = dis_i(global_random_engine);
+    for(auto &v : valueset) v = dis_i(engine);
     std::cerr<<"Done!"<<std::endl;
 
     /* draw values from valpool */
     std::cerr<<"generatin data from pool..."<<std::endl;
     //std::map<T, V> largedata, smalldata;
     src::Timeseries largedata, smalldata;
-    std::uniform_int_distribution<int> dis_idx(0, valsize);
+    std::uniform_int_distribution<int> dis_idx(0, valsize - 1);
     for(auto time : timeset)    // for large timeseries
     {
-        auto idx = dis_idx(global_random_engine);
+        auto idx = dis_idx(engine);
         largedata.insert(time, valueset[idx]);
         //largedata.insert(time, valueset[idx]);
     }
     
     for(auto ent : largedata)
     {
-        auto err = dis_err(global_random_engine);
+        auto err = dis_err(engine);
         if(std::fabs(err) < epsilon)
             smalldata.insert(ent.first + err + (double)DELTA_T, ent.second);
     }
@@ -112,8 +149,6 @@ bool TimeseriesGen::run()
      *  samll file: ${prefix}-small.ts
      */
     std::cerr<<"Print the results into file..."<<std::endl;
-    std::string largef = prefix + "large.ts",
-                smallf = prefix + "small.ts";
     std::ofstream fout_l(largef), fout_s(smallf);
     fout_l.setf(std::ios::fixed);
     fout_l.precision(8);
@@ -121,6 +156,7 @@ bool TimeseriesGen::run()
     fout_s.precision(8);
     for(auto ent : largedata) fout_l<<ent.first<<" "<<ent.second<<std::endl;
     for(auto ent : smalldata) fout_s<<ent.first<<" "<<ent.second<<std::endl;
+    std::ofstream(stampf)<<stamp()<<std::endl;
     return true;
 }
 
@@ -164,11 +200,702 @@ bool BruteForceTest::run()
 {
     src::Timeseries t1(src::TimeseriesReader::ReadTwoCols(this->file_small));
     src::Timeseries t2(src::TimeseriesReader::ReadTwoCols(this->file_large));
-    src::SolverBase *sv = new src::BruteForce(1);
-    ASSERT(sv->check(t1, t2, -10, 0.1));
-    auto res = sv->solve(t1, t2);
+    src::BruteForce sv(1);
+    ASSERT(sv.check(t1, t2, -10, 0.1));
+    auto solved = sv.solve(t1, t2);
+    auto res = solved.offset;
     std::cerr<<this->getName()<<": got res: "<<res<<std::endl;
-    ASSERT((result - res < 1e-2));
+    ASSERT(solved.found());
+    ASSERT(std::fabs(result - res) < 1e-2);
+    return true;
+}
+
+bool MinEpsilonTest::run()
+{
+    using src::Timestamp;
+    src::Timeseries t1(src::TimeseriesReader::ReadTwoCols(this->file_small));
+    src::Timeseries t2(src::TimeseriesReader::ReadTwoCols(this->file_large));
+    src::MinEpsilon sv(1);
+    auto solved = sv.solve(t1, t2);
+    auto res = solved.offset;
+    std::cerr<<this->getName()<<": got "<<solved.to_json()<<std::endl;
+    ASSERT(std::fabs(result - res) < 2e-2);
+    ASSERT_EQUAL(solved.matched_ratio, 1.);
+    ASSERT(solved.probes > 0);
+
+    /* the minimal epsilon is exact: check passes at it and fails below it */
+    src::MinEpsilon::Points_t points;
+    for(auto &ent : t1) points.emplace_back(ent.first.ticks(), ent.second);
+    src::MinEpsilon::Index_t index;
+    for(auto &ent : t2) index[ent.second].push_back(ent.first.ticks());
+    Timestamp delta_t(res);
+    auto eps = sv.min_epsilon(points, index, delta_t.ticks(), 
+            std::numeric_limits<int64_t>::max());
+    ASSERT(sv.check(t1, t2, delta_t, Timestamp::fromTicks(eps)));
+    ASSERT(!sv.check(t1, t2, delta_t, Timestamp::fromTicks(eps - 1)));
+    return true;
+}
+
+bool RefinerTest::run()
+{
+    src::Timeseries t1(src::TimeseriesReader::ReadTwoCols(this->file_small));
+    src::Timeseries t2(src::TimeseriesReader::ReadTwoCols(this->file_large));
+    src::MinEpsilon sv(1);
+    auto res = sv.solve(t1, t2).offset;
+
+    src::Refiner refiner;
+    auto est = refiner.refine(t1, t2, res, 0.05);
+    std::cerr<<this->getName()<<": got offset: "<<est.offset<<" ["<<est.ci_low
+        <<", "<<est.ci_high<<"], matches: "<<est.matches<<std::endl;
+    ASSERT_EQUAL(est.matches, t1.size());
+    ASSERT(est.ci_low <= est.offset && est.offset <= est.ci_high);
+    ASSERT(std::fabs(est.offset - result) < 1e-2);
+    ASSERT(std::fabs(est.trimmed_mean - est.median) < 1e-2);
+
+    /* same seed, same interval */
+    auto again = refiner.refine(t1, t2, res, 0.05);
+    ASSERT_EQUAL(again.ci_low, est.ci_low);
+    ASSERT_EQUAL(again.ci_high, est.ci_high);
+
+    /* the bootstrap interval agrees with the order-statistic one */
+    auto boot = src::Refiner(0.1, 0.95, 200).refine(t1, t2, res, 0.05);
+    ASSERT_EQUAL(boot.offset, est.offset);
+    ASSERT(boot.ci_low <= boot.offset && boot.offset <= boot.ci_high);
+    ASSERT(std::fabs(boot.ci_low - est.ci_low) < 1e-3);
+    ASSERT(std::fabs(boot.ci_high - est.ci_high) < 1e-3);
+
+    /* known residuals: the median is exact, 5 points only give their range */
+    auto known = refiner.estimate({0.3, -0.1, 0.2, 0.0, 0.1}, 1.);
+    ASSERT(std::fabs(known.median - 0.1) < 1e-12);
+    ASSERT(std::fabs(known.offset - 1.1) < 1e-12);
+    ASSERT(std::fabs(known.ci_low - 0.9) < 1e-12);
+    ASSERT(std::fabs(known.ci_high - 1.3) < 1e-12);
+
+    /* 1 - 2 * P(B <= 5) >= 0.95 for B ~ Binomial(20, 1/2): ranks 5 and 14 */
+    std::vector<double> twenty(20);
+    for(size_t i = 0; i < twenty.size(); i++) twenty[i] = i;
+    auto ranked = refiner.estimate(twenty, 0.);
+    ASSERT_EQUAL(ranked.ci_low, 5.);
+    ASSERT_EQUAL(ranked.ci_high, 14.);
+
+    ASSERT_FAULT(src::Refiner(0.1, 1.));
+    return true;
+}
+
+bool ParallelReadTest::run()
+{
+    using src::TimeseriesReader;
+    auto serial{TimeseriesReader::ReadTwoCols(this->fname)};
+    for(unsigned threads : {1, 2, 3, 8})
+    {
+        auto parallel{TimeseriesReader::ReadTwoColsParallel(this->fname, ' ', threads)};
+        ASSERT(serial.getData() == parallel.getData());
+    }
+
+    /* comments, empty lines and repeated delimiters */
+    std::string tmpf = this->fname + ".tmp";
+    {
+        std::ofstream fout(tmpf);
+        fout<<"# comment line\n\n1.5,,10\n#2.5,20\n0.5,30,extra\n\n3.25,40";
+    }
+    auto s2{TimeseriesReader::ReadTwoCols(tmpf, ',')};
+    auto p2{TimeseriesReader::ReadTwoColsParallel(tmpf, ',', 2)};
+    ASSERT_EQUAL(s2.size(), (size_t)3);
+    ASSERT(s2.getData() == p2.getData());
+
+    /**
+     * the same over about nine 4 KiB chunks: fixed width records fix the
+     * file size in advance, so a block of comments and empty lines can be
+     * centered on every split point of 2 to 8 threads
+     */
+    const size_t records = 1700;
+    const std::string block = "\n# comment on a chunk split ........................\n\n#\n\n";
+    std::vector<double> splits;
+    for(unsigned t = 2; t <= 8; t++)
+        for(unsigned i = 1; i < t; i++) splits.push_back((double)i / t);
+    std::sort(splits.begin(), splits.end());
+    splits.erase(std::unique(splits.begin(), splits.end()), splits.end());
+    char rec[32];
+    const size_t width = std::snprintf(rec, sizeof(rec), "%012.6f,,%06u\n", 0., 0u);
+    const size_t size = records * width + splits.size() * block.size();
+    std::vector<std::pair<size_t, size_t>> blocks;     // [begin, end) offsets
+    {
+        std::string content;
+        size_t next = 0;
+        for(size_t i = 0; i < records; i++)
+        {
+            if(next < splits.size() && content.size() + block.size() / 2 >= splits[next] * size)
+            {
+                blocks.emplace_back(content.size(), content.size() + block.size());
+                content += block;
+                next++;
+            }
+            std::snprintf(rec, sizeof(rec), "%012.6f,,%06u\n", i * 0.01, (unsigned)i % 1500);
+            content += rec;
+        }
+        ASSERT_EQUAL(next, splits.size());
+        ASSERT_EQUAL(content.size(), size);
+        std::ofstream fout(tmpf);
+        fout<<content;
+    }
+    src::ReadStats s3st;
+    auto s3{TimeseriesReader::ReadTwoCols(tmpf, ',', src::ReadMode::SKIP, &s3st)};
+    ASSERT_EQUAL(s3.size(), records);
+    ASSERT_EQUAL(s3st.malformed, (size_t)0);
+    for(unsigned threads = 2; threads <= 8; threads++)
+    {
+        ASSERT(size / 4096 + 1 >= threads);
+        for(unsigned i = 1; i < threads; i++)
+        {
+            size_t at = i * size / threads;
+            ASSERT(std::any_of(blocks.begin(), blocks.end(),
+                        [at](const std::pair<size_t, size_t> &b){ return b.first < at && at < b.second; }));
+        }
+        src::ReadStats p3st;
+        auto p3{TimeseriesReader::ReadTwoColsParallel(tmpf, ',', threads, src::ReadMode::SKIP, &p3st)};
+        ASSERT(s3.getData() == p3.getData());
+        ASSERT_EQUAL(p3st.lines, s3st.lines);
+        ASSERT_EQUAL(p3st.skipped, s3st.skipped);
+        ASSERT_EQUAL(p3st.comments, s3st.comments);
+    }
+    std::remove(tmpf.c_str());
+    return true;
+}
+
+bool CompressedReadTest::run()
+{
+    using src::TimeseriesReader;
+    std::string content;
+    {
+        std::ifstream fin(this->fname);
+        content.assign(std::istreambuf_iterator<char>(fin), std::istreambuf_iterator<char>());
+    }
+    std::string gzf = this->fname + ".gz", badf = this->fname + ".bad.gz",
+        zstf = this->fname + ".zst";
+    gzFile gz = gzopen(gzf.c_str(), "wb");
+    ASSERT(gz != NULL);
+    gzwrite(gz, content.data(), content.size());
+    gzclose(gz);
+    ASSERT(src::detect_compression(gzf) == src::Compression::GZIP);
+    ASSERT(src::detect_compression(this->fname) == src::Compression::NONE);
+
+    auto plain{TimeseriesReader::ReadTwoCols(this->fname)};
+    auto unzip{TimeseriesReader::ReadTwoCols(gzf)};
+    auto punzip{TimeseriesReader::ReadTwoColsParallel(gzf)};
+    ASSERT(plain.getData() == unzip.getData());
+    ASSERT(plain.getData() == punzip.getData());
+
+    /* a truncated archive fails instead of returning partial data */
+    {
+        std::ifstream fin(gzf, std::ios::binary);
+        std::string zipped((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+        std::ofstream fout(badf, std::ios::binary);
+        fout.write(zipped.data(), zipped.size() / 2);
+        std::ofstream zout(zstf, std::ios::binary);
+        zout<<"\x28\xb5\x2f\xfd";
+    }
+    ASSERT(src::detect_compression(zstf) == src::Compression::ZSTD);
+    ASSERT_FAULT(TimeseriesReader::ReadTwoCols(badf));
+#ifdef HAVE_ZSTD
+    /* the magic alone, then a frame cut in half */
+    ASSERT_FAULT(TimeseriesReader::ReadTwoCols(zstf));
+    std::string badz = this->fname + ".bad.zst";
+    {
+        std::string zipped(ZSTD_compressBound(content.size()), '\0');
+        size_t n = ZSTD_compress(&zipped[0], zipped.size(), content.data(), content.size(), 3);
+        ASSERT(!ZSTD_isError(n));
+        std::ofstream zout(zstf, std::ios::binary);
+        zout.write(zipped.data(), n);
+        std::ofstream bout(badz, std::ios::binary);
+        bout.write(zipped.data(), n / 2);
+    }
+    auto unzstd{TimeseriesReader::ReadTwoCols(zstf)};
+    ASSERT(plain.getData() == unzstd.getData());
+    ASSERT_FAULT(TimeseriesReader::ReadTwoCols(badz));
+    std::remove(badz.c_str());
+#endif
+    std::remove(gzf.c_str());
+    std::remove(badf.c_str());
+    std::remove(zstf.c_str());
+    return true;
+}
+
+bool ReadStatsTest::run()
+{
+    using src::TimeseriesReader;
+    using src::ReadMode;
+    std::string tmpf = "data/readstats.tmp";
+    {
+        std::ofstream fout(tmpf);
+        fout<<"# header\n1.0 10\n\n2.0\nabc 20\n   \n3.0 xyz\n#\n4.0 40\n5.0 50\n";
+    }
+    src::ReadStats st, pst;
+    auto ts{TimeseriesReader::ReadTwoCols(tmpf, ' ', ReadMode::SKIP, &st)};
+    auto pts{TimeseriesReader::ReadTwoColsParallel(tmpf, ' ', 3, ReadMode::SKIP, &pst)};
+    std::cerr<<"serial: "<<st.to_string()<<", parallel: "<<pst.to_string()<<std::endl;
+    ASSERT_EQUAL(ts.size(), (size_t)3);
+    ASSERT(ts.getData() == pts.getData());
+    for(auto &s : {st, pst})
+    {
+        ASSERT_EQUAL(s.lines, (size_t)10);   // no extra line after the last newline
+        ASSERT_EQUAL(s.comments, (size_t)2);
+        ASSERT_EQUAL(s.skipped, (size_t)2);
+        ASSERT_EQUAL(s.malformed, (size_t)3);
+    }
+    ASSERT_FAULT(TimeseriesReader::ReadTwoCols(tmpf));
+    ASSERT_FAULT(TimeseriesReader::ReadTwoColsParallel(tmpf, ' ', 2));
+
+    /* the column reader skips short rows such as a csv header by default */
+    auto cols{TimeseriesReader::ReadByColId(tmpf, 0, 1, ' ', ReadMode::SKIP, &st)};
+    ASSERT_EQUAL(cols.size(), (size_t)3);
+    std::remove(tmpf.c_str());
+    return true;
+}
+
+bool TimestampParseTest::run()
+{
+    using src::Timestamp;
+    using src::TimestampParser;
+    using Format = TimestampParser::Format;
+    Timestamp t;
+
+    /* epoch seconds keep every digit */
+    TimestampParser epoch(Format::EPOCH);
+    ASSERT(epoch.parse("1513927305.805584238", t));
+    ASSERT_EQUAL(t, Timestamp(1513927305, 805584238));
+    ASSERT(epoch.parse("-10.25", t));
+    ASSERT_EQUAL(t, Timestamp(-11, Timestamp::USEC_SCALE * 3 / 4));
+    ASSERT(!epoch.parse("abc", t));
+
+    /* wireshark local time (UTC+8) and PDCP time of day (UTC) */
+    TimestampParser ws(Format::DATE_TIME, "1970-01-01", 8);
+    ASSERT(ws.parse("2017-12-22 15:21:45.805584238", t));
+    ASSERT_EQUAL(t, Timestamp(1513927305, 805584238));
+    TimestampParser pdcp(Format::TIME_OF_DAY, "2017-12-22");
+    ASSERT(pdcp.parse("07:21:47.724255", t));
+    ASSERT_EQUAL(t, Timestamp(1513927307, 724255000));
+    ASSERT(!pdcp.parse("07:21", t));
+    ASSERT(!pdcp.parse("25:00:00", t));
+
+    TimestampParser automatic(Format::AUTO, "2017-12-22", 8);
+    ASSERT(automatic.parse("2017-12-22T15:21:45", t));
+    ASSERT_EQUAL(t, Timestamp(1513927305, 0));
+    ASSERT(automatic.parse("15:21:45.5", t));
+    ASSERT_EQUAL(t, Timestamp(1513927305, Timestamp::USEC_SCALE / 2));
+    ASSERT_FAULT(TimestampParser(Format::AUTO, "2017/12/22"));
+
+    /* the text time column agrees with the epoch column of the capture */
+    auto local{src::TimeseriesReader::ReadByColId(this->fname, 1, 0, ',',
+            src::ReadMode::SKIP, nullptr, &ws)};
+    auto utc{src::TimeseriesReader::ReadByColId(this->fname, 2, 0, ',')};
+    ASSERT(local.size() > 0);
+    ASSERT_EQUAL(local.size(), utc.size());
+    std::map<src::Timeseries::Value_t, Timestamp> by_no;    // packet No. -> time
+    for(auto &ent : utc) by_no[ent.second] = ent.first;
+    for(auto &ent : local)
+    {
+        ASSERT(by_no.count(ent.second));
+        ASSERT(std::fabs((double)(ent.first - by_no[ent.second])) < 1e-6);
+    }
+    return true;
+}
+
+bool ClusterTest::run()
+{
+    SyntheticGen::Config cfg;
+    cfg.len = 4096;
+    cfg.burst = 0.2;
+    cfg.seed = 7;
+    src::Timeseries small, large;
+    SyntheticGen(cfg).generate(small, large);
+
+    src::BruteForce sv(0.5);
+    auto res = sv.solve(small, large);
+    std::cerr<<this->getName()<<": got "<<res.to_json()<<std::endl;
+    ASSERT(res.found());
+    ASSERT(std::fabs(res.offset + cfg.offset) < 1e-2);
+    ASSERT(res.stages.size() > 0 && res.stages[0].name == "cluster");
+    ASSERT(res.stages[0].pruned > 0);
+    ASSERT(res.generated - res.stages[0].pruned < large.size());
+
+    /* one entry per stage, however many bisection levels were tried */
+    std::set<std::string> names;
+    for(auto &st : res.stages) names.insert(st.name);
+    ASSERT_EQUAL(names.size(), res.stages.size());
+    ASSERT(names.count("sampled") && names.count("full"));
+    ASSERT(res.levels > 1);
+
+    cfg.burst_len = 0;
+    ASSERT_FAULT(SyntheticGen{cfg});
+    return true;
+}
+
+bool TimeseriesLogTest::run()
+{
+    using Entry_t = src::TimeseriesLog::Entry_t;
+    SyntheticGen::Config cfg;
+    cfg.len = 20000;
+    cfg.seed = 3;
+    src::Timeseries small, large;
+    SyntheticGen(cfg).generate(small, large);
+
+    /* append in order, with a few late points */
+    src::TimeseriesLog lsmall(256), llarge(256);
+    for(auto &ent : small) lsmall.append(ent.first, ent.second);
+    std::vector<Entry_t> late;
+    for(auto &ent : large)
+    {
+        if(late.size() < 16 && ent.second % 97 == 0) late.push_back(ent);
+        else llarge.append(ent.first, ent.second);
+    }
+    for(auto &ent : late) llarge.append(ent.first, ent.second);
+    ASSERT_EQUAL(llarge.size(), large.size());
+    ASSERT(llarge.merges() > 0);
+    ASSERT(llarge.deltaSize() <= std::max<size_t>(256, llarge.size() / 8));
+
+    /* queries span base and delta */
+    ASSERT(llarge.getTimeSet() == large.getTimeSet());
+    ASSERT(llarge.getValueSet() == large.getValueSet());
+    ASSERT(llarge.toTimeseries().getData() == large.getData());
+    auto lo = large.getTimeSet()[100], hi = large.getTimeSet()[5000];
+    auto in_range = llarge.range(lo, hi);
+    ASSERT_EQUAL(in_range.size(), (size_t)4901);
+    ASSERT(in_range.front().first == lo && in_range.back().first == hi);
+    for(auto &ent : llarge.index())
+        ASSERT(std::is_sorted(ent.second.begin(), ent.second.end()));
+
+    /* solving on the logs gives the same answer */
+    src::MinEpsilon sv(1);
+    auto r1 = sv.solve(small, large);
+    auto r2 = sv.solve(lsmall, llarge);
+    ASSERT(r1.found() && r2.found());
+    ASSERT_EQUAL(r1.offset, r2.offset);
+    ASSERT_EQUAL(r1.epsilon, r2.epsilon);
+    return true;
+}
+
+bool TimeseriesViewTest::run()
+{
+    using src::Timestamp;
+    SyntheticGen::Config cfg;
+    cfg.len = 30000;    // about 300 seconds
+    cfg.seed = 11;
+    src::Timeseries small, large;
+    SyntheticGen(cfg).generate(small, large);
+
+    /* bounds of the view */
+    auto times = large.getTimeSet();
+    src::TimeseriesView all(large), mid(large, times[1000], times[2000]);
+    ASSERT_EQUAL(all.size(), large.size());
+    ASSERT_EQUAL(mid.size(), (size_t)1000);
+    ASSERT(mid.begin()->first == times[1000]);
+    ASSERT(mid.getTimeSet() == std::vector<Timestamp>(times.begin() + 1000, times.begin() + 2000));
+    ASSERT(mid.lower_bound(times[0]) == mid.begin());
+    ASSERT(mid.lower_bound(times[2500]) == mid.end());
+    ASSERT(mid.upper_bound(times[1000])->first == times[1001]);
+    ASSERT(mid.upper_bound(times[1999]) == mid.end());
+    auto sub = mid.slice(times[1500], times[3000]);
+    ASSERT_EQUAL(sub.size(), (size_t)500);
+    ASSERT(src::TimeseriesView(large, times[5], times[5]).empty());
+
+    /* align one minute windows of the small series against the large one */
+    src::MinEpsilon sv(1);
+    auto t0 = small.begin()->first;
+    for(int w = 0; w < 3; w++)
+    {
+        src::TimeseriesView window(small, t0 + 60. * w, t0 + 60. * (w + 1));
+        auto res = sv.solve(window, large);
+        ASSERT(res.found());
+        ASSERT(std::fabs(res.offset + cfg.offset) < 2 * cfg.jitter);
+        ASSERT(sv.check(window, large, res.offset, res.epsilon + 1e-6));
+    }
+
+    /* a window of the large series without the matching part has no solution */
+    src::TimeseriesView early(small, t0, t0 + 60.);
+    src::TimeseriesView late(large, times[20000], times.back());
+    ASSERT(!sv.solve(early, late).found());
+
+    /* windows ending past the last large point */
+    src::Timeseries one;
+    one.insert(times.back() - 1., 1);
+    ASSERT(!sv.check(one, large, 1., 0.5));
+    ASSERT(!sv.check(one, large, 1e6, 0.5));
+    ASSERT(!sv.check(one, mid, 0., 0.5));
+
+    /* an empty slice on either side is no solution, not a read past its end */
+    src::TimeseriesView none(small, times[5], times[5]);
+    src::BruteForce bf(1);
+    ASSERT(none.empty());
+    ASSERT(!bf.solve(none, large).found());
+    ASSERT(!bf.solve(small, none).found());
+    ASSERT(!sv.solve(none, large).found());
+    ASSERT(!sv.solve(small, none).found());
+    return true;
+}
+
+bool FlowTest::run()
+{
+    SyntheticGen::Config cfg;
+    cfg.len = 20000;
+    cfg.seed = 5;
+    src::Timeseries small, large;
+    SyntheticGen(cfg).generate(small, large);
+
+    /* spread the small series over three flows of a csv capture export,
+     * with empty fields as in the real exports, plus a tiny fourth flow.
+     * The Time column holds UTC+8 local times, the epoch column is empty */
+    std::string tmpf = "data/flows.tmp";
+    const char *hosts[] = {"10.0.0.1", "10.0.0.2", "10.0.0.3"};
+    {
+        std::ofstream file(tmpf);
+        std::ostream &fout = file;  // not the Timestamp overload for ofstream
+        fout<<"No,Time,timestamp,Source,Destination,Protocol,srcport,dstport,len\n";
+        size_t i = 0;
+        char buf[64];
+        for(auto &p : small)
+        {
+            long long local = p.first.sec + 8 * 3600;
+            std::snprintf(buf, sizeof(buf), "1970-01-01 %02lld:%02lld:%02lld.%09lld", 
+                    local / 3600, local / 60 % 60, local % 60, (long long)p.first.usec);
+            fout<<i<<","<<buf<<",,"<<hosts[i % 3]<<",1.2.3.4,TCP,"<<(40000 + i % 3)
+                <<",443,,"<<p.second<<"\n";
+            i++;
+        }
+        fout<<i<<","<<buf<<",,10.0.0.9,1.2.3.4,TCP,5000,80,,0\n";
+    }
+    src::FlowColumns cols;
+    cols.value = 9;
+    cols.header = -1;
+    cols.overhead = 0;
+    cols.excluded.clear();
+    src::ReadStats st;
+    src::TimestampParser local(src::TimestampParser::Format::DATE_TIME, "1970-01-01", 8);
+    auto flows{src::FlowReader::ReadFlows(tmpf, cols, ',', src::ReadMode::SKIP, &st, &local)};
+    std::remove(tmpf.c_str());
+    ASSERT_EQUAL(flows.size(), (size_t)4);
+    ASSERT_EQUAL(st.malformed, (size_t)1);     // the header
+    size_t total = 0;
+    for(auto &ent : flows) total += ent.second.size();
+    ASSERT_EQUAL(total, small.size() + 1);
+    src::FlowKey key{"10.0.0.2", "1.2.3.4", "40001", "443", "tcp"};
+    ASSERT(flows.count(key));
+    ASSERT_EQUAL(flows[key].size(), (small.size() + 1) / 3);
+    ASSERT(flows[key].begin()->first == std::next(small.begin())->first);
+
+    /* every flow agrees on the offset, the tiny flow is left out */
+    src::FlowAligner aligner([]{ return std::unique_ptr<src::SolverBase>(new src::MinEpsilon(1)); },
+            3);
+    auto results = aligner.align(flows, large);
+    ASSERT_EQUAL(results.size(), (size_t)3);
+    auto consensus = src::FlowAligner::consensus(results);
+    std::cerr<<"consensus offset: "<<consensus<<std::endl;
+    ASSERT(std::fabs(consensus + cfg.offset) < 2 * cfg.jitter);
+    for(auto &fr : results)
+    {
+        ASSERT(fr.consistent);
+        ASSERT(std::fabs(fr.result.offset + cfg.offset) < 2 * cfg.jitter);
+        ASSERT(fr.log.find("MinEpsilon::solve") != std::string::npos);
+    }
+    ASSERT(std::isnan(src::FlowAligner::consensus({})));
+
+    /* rows of data/real/1c.csv: the values are the PDCP PDU sizes, 
+     * tcp.len + tcp.hdr_len + 22, the SYN (74) and the full segment 
+     * (1412) are excluded as in data/real/filter_pdcp.sh */
+    {
+        std::ofstream fout(tmpf);
+        fout<<"_ws.col.No.,_ws.col.Time,timestamp,_ws.col.Source,_ws.col.Destination,"
+            "_ws.col.Protocol,tcp.srcport,tcp.dstport,tcp.ack,tcp.seq,tcp.flags.syn,"
+            "tcp.flags.ack,tcp.flags.fin,tcp.flags.reset,tcp.options.mptcp.rawdataseqno,"
+            "tcp.window_size,tcp.len,tcp.hdr_len,,,,,,\n"
+            "1,2017-12-22 15:21:45.805584238,1513927305.8055842,192.168.82.72,222.29.98.225,"
+            "MPTCP,59027,40002,0,3156777492,1,0,0,0,,29200,0,52,,,,,,\n"
+            "2,2017-12-22 15:21:46.009241170,1513927306.009241,222.29.98.225,192.168.82.72,"
+            "TCP,40002,59027,3156777493,341331421,1,1,0,0,,28960,0,40,,0.203656932,,,,\n"
+            "4,2017-12-22 15:21:46.200272626,1513927306.2002726,222.29.98.225,192.168.82.72,"
+            "TCP,40002,59027,3156777493,341331422,0,1,0,0,,29056,1358,32,,,,,,1358\n"
+            "13220,2017-12-22 15:21:55.059324248,1513927315.0593243,192.168.82.72,"
+            "222.29.98.225,TCP,59027,40002,351707900,3156777493,0,1,0,0,,3145728,0,60,,,,,,\n";
+    }
+    flows = src::FlowReader::ReadFlows(tmpf, src::FlowColumns(), ',', src::ReadMode::SKIP,
+            &st, &local);
+    std::remove(tmpf.c_str());
+    ASSERT_EQUAL(st.malformed, (size_t)1);
+    ASSERT_EQUAL(flows.size(), (size_t)2);
+    src::FlowKey up{"192.168.82.72", "222.29.98.225", "59027", "40002", "tcp"};
+    src::FlowKey down{"222.29.98.225", "192.168.82.72", "40002", "59027", "tcp"};
+    ASSERT_EQUAL(flows[up].size(), (size_t)1);
+    ASSERT_EQUAL(flows[down].size(), (size_t)1);
+    ASSERT_EQUAL(flows[up].begin()->second, (size_t)82);
+    ASSERT_EQUAL(flows[down].begin()->second, (size_t)62);
+    ASSERT(flows[up].begin()->first == src::Timestamp(1513927315, 59324248));
+
+    /* the same size as the PDCP record of the ack */
+    {
+        std::ofstream fout(tmpf);
+        fout<<"2017-12-22 07:21:54.250175 $ LTE_PDCP_UL_Cipher_Data_PDU $ PDU Size: 82\n";
+    }
+    auto pdcp{src::TimeseriesReader::ReadPdcpLog(tmpf)};
+    std::remove(tmpf.c_str());
+    ASSERT_EQUAL(src::Timeseries::untag(pdcp.begin()->second), flows[up].begin()->second);
+    return true;
+}
+
+bool DirectionTest::run()
+{
+    using src::Timeseries;
+    using src::Direction;
+    ASSERT_EQUAL(Timeseries::untag(Timeseries::tag(54, Direction::UPLINK)), (size_t)54);
+    ASSERT(Timeseries::direction(Timeseries::tag(54, Direction::DOWNLINK)) == Direction::DOWNLINK);
+    ASSERT(Timeseries::tag(Timeseries::tag(54, Direction::UPLINK), Direction::ANY) == 54);
+
+    /* the PDCP log reader tags the records by their type */
+    std::string tmpf = "data/pdcp.tmp";
+    {
+        std::ofstream fout(tmpf);
+        fout<<"2017-12-22 07:21:47.724255 $ LTE_PDCP_UL_Cipher_Data_PDU $ PDU Size: 54\n"
+            <<"2017-12-22 07:21:47.724255 $ LTE_PDCP_DL_Cipher_Data_PDU $ PDU Size: 54\n"
+            <<"2017-12-22 07:21:47.800000 $ LTE_PDCP_DL_Cipher_Data_PDU $ PDU Size: 1412\n"
+            <<"2017-12-22 07:21:47.900000 $ LTE_PDCP_DL_Config $ no size\n";
+    }
+    src::ReadStats st;
+    auto pdcp{src::TimeseriesReader::ReadPdcpLog(tmpf, src::ReadMode::SKIP, &st)};
+    std::remove(tmpf.c_str());
+    ASSERT_EQUAL(pdcp.size(), (size_t)3);
+    ASSERT_EQUAL(st.malformed, (size_t)1);
+    ASSERT_EQUAL(pdcp.select(Direction::UPLINK).size(), (size_t)1);
+    auto dl = pdcp.select(Direction::DOWNLINK);
+    ASSERT_EQUAL(dl.size(), (size_t)2);
+    ASSERT_EQUAL(Timeseries::untag(dl.getValueSet().back()), (size_t)1412);
+
+    /**
+     * an uplink series, whose large series also holds a downlink copy of
+     * it 3 seconds earlier: untagged the copy is a perfect false match
+     */
+    SyntheticGen::Config cfg;
+    cfg.len = 10000;
+    cfg.seed = 3;
+    Timeseries small, large;
+    SyntheticGen(cfg).generate(small, large);
+    Timeseries decoy;
+    for(auto &p : small) decoy.insert(p.first - 3., p.second);
+    auto mixed = [&](Direction up, Direction down)
+    {
+        Timeseries ret;
+        for(auto &p : large) ret.insert(p.first, Timeseries::tag(p.second, up));
+        for(auto &p : decoy) ret.insert(p.first, Timeseries::tag(p.second, down));
+        return ret;
+    };
+    auto plain = mixed(Direction::ANY, Direction::ANY);
+    auto tagged = mixed(Direction::UPLINK, Direction::DOWNLINK);
+    src::MinEpsilon sv(1);
+    auto wrong = sv.solve(small, plain);
+    ASSERT(std::fabs(wrong.offset + 3.) < 1e-6);
+    small.setDirection(Direction::UPLINK);
+    auto res = sv.solve(small, tagged);
+    ASSERT(res.found());
+    ASSERT(std::fabs(res.offset + cfg.offset) < 2 * cfg.jitter);
+    ASSERT(!sv.check(small, tagged, wrong.offset, 1e-6));
+    ASSERT(res.generated < wrong.generated);
+
+    /* a tagged series never matches an untagged one: rejected, not unsolved */
+    src::BruteForce bf(1);
+    ASSERT_FAULT(sv.solve(small, plain));
+    ASSERT_FAULT(bf.solve(small, plain));
+    ASSERT_FAULT(sv.solve(small, large));
+
+    /* values reaching the direction bits are malformed */
+    {
+        std::ofstream fout(tmpf);
+        fout<<"1.0 4611686018427387903\n2.0 4611686018427387904\n3.0 -1\n4.0 54\n";
+    }
+    auto bounded{src::TimeseriesReader::ReadTwoCols(tmpf, ' ', src::ReadMode::SKIP, &st)};
+    std::remove(tmpf.c_str());
+    ASSERT_EQUAL(bounded.size(), (size_t)2);
+    ASSERT_EQUAL(st.malformed, (size_t)2);
+    ASSERT_EQUAL(bounded.getValueSet().front(), Timeseries::MAX_VALUE);
+    ASSERT(Timeseries::direction(bounded.getValueSet().front()) == Direction::ANY);
+    return true;
+}
+
+bool SketchTest::run()
+{
+    SyntheticGen::Config cfg;
+    cfg.len = 20000;
+    cfg.seed = 7;
+    src::Timeseries small, large;
+    SyntheticGen(cfg).generate(small, large);
+    src::ValueTimeSketch sketch(large, 0.01);
+    std::cerr<<"sketch: "<<sketch.bits()<<" bits, fill ratio "<<sketch.fillRatio()<<std::endl;
+
+    /* no false negatives, few false positives for absent values */
+    for(auto &p : large)
+        ASSERT(sketch.mayContain(p.second, p.first, 0));
+    size_t fp = 0, probes = 0;
+    for(auto &p : large)
+    {
+        fp += sketch.mayContain(p.second + cfg.values, p.first, 0.005);
+        probes++;
+    }
+    std::cerr<<"sketch: false positive rate "<<(double)fp / probes<<std::endl;
+    ASSERT(fp < probes / 20);
+    ASSERT(sketch.mayContain(cfg.values, large.begin()->first, 1e3));  // too wide to filter
+
+    /* the prefilter only removes candidates, the solution is unchanged */
+    src::BruteForce plain(0.5), filtered(0.5);
+    filtered.setSketch(&sketch);
+    src::SolveResult r1, r2;
+    ASSERT_TIME(0.5, r1 = plain.solve(small, large));
+    ASSERT_TIME(0.5, r2 = filtered.solve(small, large));
+    ASSERT(r1.found() && r2.found());
+    ASSERT_EQUAL(r1.offset, r2.offset);
+    ASSERT_EQUAL(r1.prefilter.tested, (size_t)0);
+    ASSERT(r2.prefilter.tested > 0);
+    ASSERT(r2.prefilter.passed <= r2.prefilter.tested);
+    ASSERT(r2.prefilter.false_positives <= r2.prefilter.passed);
+    ASSERT(r2.probes <= r1.probes);
+    return true;
+}
+
+bool InstrumentTest::run()
+{
+    using src::Instrument;
+    auto outer = Instrument::probe("test outer");
+    auto inner = Instrument::probe("test inner");
+    auto events = Instrument::probe("test events");
+    ASSERT_EQUAL(Instrument::probe("test outer"), outer);
+
+    /* per-thread counters are summed over the finished threads */
+    std::vector<std::thread> workers;
+    for(int i = 0; i < 4; i++)
+    {
+        workers.emplace_back([=]()
+        {
+            for(int j = 0; j < 1000; j++) Instrument::count(events);
+            Instrument::Scope s(outer);
+        });
+    }
+    for(auto &w : workers) w.join();
+    {
+        Instrument::Scope s(outer);
+        Instrument::Scope t(inner);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    for(auto &p : Instrument::snapshot())
+    {
+        if(p.name == "test events") ASSERT_EQUAL(p.count, (uint64_t)4000);
+        if(p.name == "test outer") ASSERT_EQUAL(p.count, (uint64_t)5);
+        if(p.name == "test inner")
+        {
+            ASSERT_EQUAL(p.count, (uint64_t)1);
+            ASSERT(p.seconds >= 2e-3);
+        }
+    }
+
+    /* the nested scope is a stack of the trace, with its own time */
+    auto folded = Instrument::folded();
+    ASSERT(folded.find("test outer;test inner ") != std::string::npos);
+    auto pos = folded.find("test outer;test inner ") + std::string("test outer;test inner ").size();
+    ASSERT(std::stoull(folded.substr(pos)) >= 2000);
     return true;
 }
 
@@ -10,7 +10,22 @@ class TimestampTest;
 class TimeseriesTest;
 class SolverTest;
 class BruteForceTest;
+class MinEpsilonTest;
+class RefinerTest;
+class ParallelReadTest;
+class CompressedReadTest;
+class ReadStatsTest;
+class TimestampParseTest;
+class ClusterTest;
+class TimeseriesLogTest;
+class TimeseriesViewTest;
 
+/**
+ * class TimeseriesGen
+ * write ${prefix}large.ts and ${prefix}small.ts from a seeded generator.
+ * The parameters are kept in ${prefix}gen.stamp, and the files are only
+ * generated again when they are missing or the parameters changed
+ */
 class TimeseriesGen :public Test
 {
     public:
@@ -20,10 +35,13 @@ class TimeseriesGen :public Test
         double tl, th;
         size_t vl, vh;
         size_t len;
+        unsigned seed;
+
+        std::string stamp() const;
     public:
         TimeseriesGen(const std::string &pre, double tlow, double thigh,
-                size_t vlow, size_t vhigh, size_t length = 32768)
-            : prefix(pre), tl(tlow), th(thigh), vl(vlow), vh(vhigh), len(length) {}
+                size_t vlow, size_t vhigh, size_t length = 32768, unsigned sd = 0)
+            : prefix(pre), tl(tlow), th(thigh), vl(vlow), vh(vhigh), len(length), seed(sd) {}
 
         virtual std::string getName() const override
         {
@@ -95,5 +113,170 @@ class BruteForceTest : public Test
         virtual bool run() override;
 };
 
+class MinEpsilonTest : public Test
+{
+    private:
+        std::string file_small;
+        std::string file_large;
+        double result;
+    public:
+        MinEpsilonTest(const std::string &sf, const std::string &lf, double res)
+            : file_small(sf), file_large(lf), result(res){}
+        virtual std::string getName() const override
+        {
+            return "Minimal epsilon test";
+        }
+
+        virtual bool run() override;
+};
+
+class RefinerTest : public Test
+{
+    private:
+        std::string file_small;
+        std::string file_large;
+        double result;
+    public:
+        RefinerTest(const std::string &sf, const std::string &lf, double res)
+            : file_small(sf), file_large(lf), result(res){}
+        virtual std::string getName() const override
+        {
+            return "Offset refinement test";
+        }
+
+        virtual bool run() override;
+};
+
+class ParallelReadTest : public Test
+{
+    private:
+        std::string fname;
+    public:
+        ParallelReadTest(const std::string &f) : fname(f) {}
+        virtual std::string getName() const override
+        {
+            return "Testing parallel file loading";
+        }
+
+        virtual bool run() override;
+};
+
+class CompressedReadTest : public Test
+{
+    private:
+        std::string fname;
+    public:
+        CompressedReadTest(const std::string &f) : fname(f) {}
+        virtual std::string getName() const override
+        {
+            return "Testing compressed file loading";
+        }
+
+        virtual bool run() override;
+};
+
+class ReadStatsTest : public Test
+{
+    public:
+        virtual std::string getName() const override
+        {
+            return "Testing malformed records and read stats";
+        }
+
+        virtual bool run() override;
+};
+
+class TimestampParseTest : public Test
+{
+    private:
+        std::string fname;
+    public:
+        TimestampParseTest(const std::string &f) : fname(f) {}
+        virtual std::string getName() const override
+        {
+            return "Testing textual timestamp parsing";
+        }
+
+        virtual bool run() override;
+};
+
+/* candidate clustering of BruteForce on bursty synthetic data */
+class ClusterTest : public Test
+{
+    public:
+        virtual std::string getName() const override
+        {
+            return "Testing candidate clustering";
+        }
+
+        virtual bool run() override;
+};
+
+class TimeseriesLogTest : public Test
+{
+    public:
+        virtual std::string getName() const override
+        {
+            return "Testing append-optimized timeseries";
+        }
+
+        virtual bool run() override;
+};
+
+class TimeseriesViewTest : public Test
+{
+    public:
+        virtual std::string getName() const override
+        {
+            return "Testing timeseries views";
+        }
+
+        virtual bool run() override;
+};
+
+class FlowTest : public Test
+{
+    public:
+        virtual std::string getName() const override
+        {
+            return "Testing multi-flow alignment";
+        }
+
+        virtual bool run() override;
+};
+
+class DirectionTest : public Test
+{
+    public:
+        virtual std::string getName() const override
+        {
+            return "Testing direction-tagged matching";
+        }
+
+        virtual bool run() override;
+};
+
+class SketchTest : public Test
+{
+    public:
+        virtual std::string getName() const override
+        {
+            return "Testing value-time sketch prefilter";
+        }
+
+        virtual bool run() override;
+};
+
+class InstrumentTest : public Test
+{
+    public:
+        virtual std::string getName() const override
+        {
+            return "Testing instrumentation counters";
+        }
+
+        virtual bool run() override;
+};
+
 } // namespace test
 #endif